@@ -2,40 +2,65 @@
 #define ACCOUNT_H
 
 #include "YearRecords.h"
+#include "BalanceIndex.h"
 #include "ValueType.h"
 #include "Date.h"
 #include "JournalModification.h"
 
+#include <cstdint>
+#include <limits>
+
 #include <string>
 using std::string;
 
 #include <vector>
 using std::vector;
 
+//Stable index of an account in its library's account table
+using AccountId = uint32_t;
+constexpr AccountId NO_ACCOUNT = std::numeric_limits<AccountId>::max();
+
 enum AccountType {
     Asset, Liability, StockholdersEquity, Revenue, Expense, GAIN, LOSS, Dividends, ContraAsset, ContraLiability, ContraEquity, ContraRevenue, ContraExpense
 };
 
 class Account {
+    private:
+        friend class AccountLibrary;
+        AccountId id = NO_ACCOUNT; //Assigned when a library adopts the account
     protected:
         string name;
         YearRecords records;
+        BalanceIndex dailyChanges;
         DateUnit year;
         ValueType valueType;
         AccountType accountType;
-        Account(const string& name, ValueType valueType, AccountType accountType, DateUnit year, double beginningBalance = 0) : name(name), valueType(valueType), accountType(accountType), year(year), records(year, valueType, beginningBalance) {}
+        Account(const string& name, ValueType valueType, AccountType accountType, DateUnit year, Money beginningBalance = 0) : name(name), valueType(valueType), accountType(accountType), year(year), records(year, valueType, beginningBalance) {}
     public:
         const string& getName() const { return name; }
-        double getBalance() const { return records.getEndingBalance(); }
-        double getBeginningBalance() const { return records.getBeginningBalance(); }
+        AccountId getId() const { return id; } //NO_ACCOUNT for an account outside any library
+        Money getBalance() const { return records.getEndingBalance(); }
+        Money getBeginningBalance() const { return records.getBeginningBalance(); }
         ValueType getBalanceType() const { return valueType; }
         AccountType getAccountType() const { return accountType; }
         DateUnit getYear() const { return year; }
         void addEntry(JournalModification*);
-        const vector<JournalModification*> &getEntries() const { return records.getEntries(); }
-        const vector<JournalModification*> &getQuartersEntries(DateUnit quarter) const { return records.getQuarterRecords()[quarter-1].getEntries(); }
-        const vector<JournalModification*> &getMonthsEntries(DateUnit month) const { return records.getQuarterRecords()[(month-1) / 3].getMonthRecords()[(month-1) % 3].getEntries(); }
+        void addEntries(span<JournalModification* const>); //Batch form of addEntry, periods are updated once
+        //Bulk form for an account with no entries yet, given them in date order. Post through JournalEntryPoster::loadEntries
+        //so views subscribed to the poster follow.
+        void loadEntries(span<JournalModification* const>);
+        //Moves the opening balance, and every balance after it, by delta. Post through JournalEntryPoster::shiftBeginningBalance
+        //so views subscribed to the poster follow.
+        void shiftBeginningBalance(Money delta) { records.shiftYearBalances(delta); }
+        //Forgets the entries of months [1, month] while every balance, daily ones included, is kept. See ProgramManager::compactThrough
+        void dropEntriesThrough(DateUnit month) { records.dropEntriesThrough(month); }
+        EntryView getEntries() const { return records.getEntries(); }
+        EntryView getQuartersEntries(DateUnit quarter) const { return records.getQuarterRecords()[quarter-1].getEntries(); }
+        EntryView getMonthsEntries(DateUnit month) const { return records.getQuarterRecords()[(month-1) / 3].getMonthRecords()[(month-1) % 3].getEntries(); }
         const YearRecords &getRecords() const { return records; }
+        Money getBalanceAsOf(const Date&) const; //Balance at the end of the given day
+        Money getBalanceBefore(const Date&) const; //Balance at the start of the given day
+        Money getNetChange(const Date& from, const Date& to) const; //Net change over [from, to]
 
         bool operator==(const Account&) const;
 };
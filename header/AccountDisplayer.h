@@ -5,14 +5,16 @@
 using std::ostream;
 
 #include "Account.h"
+#include "ColdStore.h"
 #include "Period.h"
 
 class AccountDisplayer {
     private:
         Account* toDisplay;
         Period period;
+        ColdStore* cold; //Supplies lines of compacted months when set, without it they show as balances only
     public:
-        AccountDisplayer(Account* toDisplay, const Period& period) : toDisplay(toDisplay), period(period) {}
+        AccountDisplayer(Account* toDisplay, const Period& period, ColdStore* cold = nullptr) : toDisplay(toDisplay), period(period), cold(cold) {}
 
         void display(ostream&) const;
 };
@@ -1,51 +1,134 @@
 #ifndef ACCOUNT_LIBRARY_H
 #define ACCOUNT_LIBRARY_H
 
-#include <list>
-using std::list;
+#include <array>
+using std::array;
 
-#include <unordered_map>
-using std::unordered_map;
+#include <deque>
+using std::deque;
+
+#include <vector>
+using std::vector;
+
+#include <cstdint>
+#include <iterator>
 
 #include <string>
 using std::string;
 
+#include <string_view>
+using std::string_view;
+
 #include "Accounts.h"
+#include "SymbolTable.h"
+
+constexpr size_t ACCOUNT_TYPE_COUNT = AccountType::ContraExpense + 1;
+
+//Read-only range over the accounts named by a list of ids, iterates as const Account&
+class AccountView {
+    private:
+        const deque<Account>* table;
+        const vector<AccountId>* ids;
+    public:
+        class const_iterator {
+            private:
+                const deque<Account>* table;
+                vector<AccountId>::const_iterator position;
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Account;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const Account*;
+                using reference = const Account&;
+
+                const_iterator() : table(nullptr) {}
+                const_iterator(const deque<Account>* table, vector<AccountId>::const_iterator position) : table(table), position(position) {}
+                reference operator*() const { return (*table)[*position]; }
+                pointer operator->() const { return &(*table)[*position]; }
+                const_iterator& operator++() { ++position; return *this; }
+                const_iterator operator++(int) { const_iterator ret = *this; ++position; return ret; }
+                bool operator==(const const_iterator& rhs) const { return position == rhs.position; }
+                bool operator!=(const const_iterator& rhs) const { return position != rhs.position; }
+        };
+
+        AccountView(const deque<Account>* table, const vector<AccountId>* ids) : table(table), ids(ids) {}
+        const_iterator begin() const { return const_iterator(table, ids->begin()); }
+        const_iterator end() const { return const_iterator(table, ids->end()); }
+        size_t size() const { return ids->size(); }
+        bool empty() const { return ids->empty(); }
+        const Account& front() const { return (*table)[ids->front()]; }
+        const Account& operator[](size_t i) const { return (*table)[(*ids)[i]]; }
+        const vector<AccountId>& getIds() const { return *ids; }
+};
 
 class AccountLibrary {
     private:
-        list<AssetAccount> assets;
-        list<LiabilityAccount> liabilities;
-        list<StockholdersEquityAccount> stockholdersEquity;
-        list<ContraEquityAccount> lessEquity;
-        list<RevenueAccount> revenues;
-        list<ExpenseAccount> expenses;
-        list<GainAccount> gains;
-        list<LossAccount> losses;
-        list<DividendsAccount> dividends;
-        unordered_map<Account*, Account> contraLinker;
-        unordered_map<string, Account*> nameLinker;
+        //Every account, contra accounts included, lives in one table and is addressed by its AccountId
+        //deque keeps references stable as the chart grows, so Account* held by journal entries stay valid
+        deque<Account> table;
+        array<vector<AccountId>, ACCOUNT_TYPE_COUNT> typeIndex;
+        vector<AccountId> lessEquity; //Contra equity accounts added on their own, typeIndex also lists linked ones
+        vector<AccountId> contraLinks; //contraLinks[id] is the contra account linked to id, or NO_ACCOUNT
+        //Every name and alias ever used is interned once, symbolTargets[symbol] is the account it names or NO_ACCOUNT once removed
+        SymbolTable symbols;
+        vector<AccountId> symbolTargets;
         DateUnit year;
-        string toUpper(const string&) const; 
+        AccountId insertAccount(Account&&);
+        bool bindName(string_view, AccountId); //False when the name already names an account
+        AccountView getView(AccountType type) const { return AccountView(&table, &typeIndex[type]); }
     public:
         AccountLibrary(DateUnit year) : year(year) {}
         DateUnit getYear() const { return year; }
-        void addAccount(const string&, AccountType, double beginningBalance = 0);
-        void linkAccount(const string&, const string&, AccountType, double beginningBalance = 0);
-        Account* findLinked(const string&);
-        bool addAlias(const string&, const string&);
-        void removeAlias(const string&);
-        Account& getAccount(const string& );
-        const Account& getAccount(const string&) const ;
-        const list<AssetAccount> getAssets() const { return assets; }
-        const list<LiabilityAccount> getLiabilities() const { return liabilities; }
-        const list<StockholdersEquityAccount> getStockholdersEquity() const { return stockholdersEquity; }
-        const list<ContraEquityAccount> getContraEquity() const { return lessEquity; }
-        const list<RevenueAccount> getRevenues() const { return revenues; }
-        const list<ExpenseAccount> getExpenses() const { return expenses; }
-        const list<GainAccount> getGains() const { return gains; }
-        const list<LossAccount> getLosses() const { return losses; }
-        const list<DividendsAccount> getDividends() const { return dividends; }
+        void addAccount(const string&, AccountType, Money beginningBalance = 0);
+        void linkAccount(const string&, const string&, AccountType, Money beginningBalance = 0);
+        void linkAccount(AccountId original, const string&, AccountType, Money beginningBalance = 0);
+        Account* findLinked(string_view);
+        bool addAlias(string_view, const string&);
+        bool addAlias(AccountId, const string&); //False when the alias already names an account
+        void removeAlias(string_view);
+        Account& getAccount(string_view);
+        const Account& getAccount(string_view) const;
+
+        AccountId getAccountId(string_view) const; //Throws invalid_argument for an unknown alias
+        //Resolve a name to its symbol once, then map symbols to accounts without hashing
+        SymbolId findSymbol(string_view name) const { return symbols.find(name); }
+        const string& getSymbolName(SymbolId symbol) const { return symbols.getName(symbol); }
+        AccountId resolve(SymbolId symbol) const { return symbol < symbolTargets.size() ? symbolTargets[symbol] : NO_ACCOUNT; }
+        Account& getAccount(AccountId id) { return table.at(id); }
+        const Account& getAccount(AccountId id) const { return table.at(id); }
+        AccountId getLinkedId(AccountId id) const { return contraLinks.at(id); } //NO_ACCOUNT when nothing is linked
+        size_t getAccountCount() const { return table.size(); }
+        size_t getSymbolCount() const { return symbolTargets.size(); } //Symbols are dense, [0, count) covers every name ever bound
+
+        AccountView getAccounts(AccountType type) const { return getView(type); }
+        AccountView getAssets() const { return getView(AccountType::Asset); }
+        AccountView getLiabilities() const { return getView(AccountType::Liability); }
+        AccountView getStockholdersEquity() const { return getView(AccountType::StockholdersEquity); }
+        //Only contra equity accounts added with addAccount, getAccounts(ContraEquity) also lists those linked to an equity account
+        AccountView getContraEquity() const { return AccountView(&table, &lessEquity); }
+        AccountView getRevenues() const { return getView(AccountType::Revenue); }
+        AccountView getExpenses() const { return getView(AccountType::Expense); }
+        AccountView getGains() const { return getView(AccountType::GAIN); }
+        AccountView getLosses() const { return getView(AccountType::LOSS); }
+        AccountView getDividends() const { return getView(AccountType::Dividends); }
+
+        //Calls function(const Account&) for every account of the given type, contra accounts are listed under their own type
+        template<typename Function>
+        void forEachAccount(AccountType type, Function function) const;
+        //Calls function(const Account&) for every account in id order, a single pass over the table
+        template<typename Function>
+        void forEachAccount(Function function) const;
 };
 
-#endif
\ No newline at end of file
+template<typename Function>
+void AccountLibrary::forEachAccount(AccountType type, Function function) const {
+    if(static_cast<size_t>(type) >= ACCOUNT_TYPE_COUNT) return;
+    for(AccountId id : typeIndex[type]) function(table[id]);
+}
+
+template<typename Function>
+void AccountLibrary::forEachAccount(Function function) const {
+    for(const Account& account : table) function(account);
+}
+
+#endif
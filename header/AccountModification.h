@@ -3,6 +3,7 @@
 
 #include "ValueType.h"
 #include "Date.h"
+#include "Money.h"
 
 #include <string>
 using std::string;
@@ -10,17 +11,24 @@ using std::string;
 #include <utility>
 using std::pair;
 
+#include <memory>
+using std::shared_ptr;
+
 class AccountModification {
     protected:
-        double amount;
+        Money amount;
         ValueType type;
         Date day;
-        string description;
-        AccountModification(double amount, ValueType type, const Date &day, const string& description) : amount(amount), type(type), day(day), description(description) {}
+        shared_ptr<const string> description; //Lines of one entry share a single copy of the memo
+        AccountModification(Money amount, ValueType type, const Date &day, const string& description) : amount(amount), type(type), day(day), description(std::make_shared<const string>(description)) {}
+        AccountModification(Money amount, ValueType type, const Date &day, shared_ptr<const string> description) : amount(amount), type(type), day(day), description(std::move(description)) {}
     public:
-        pair<double, ValueType> get() const { return pair(amount, type); }
+        pair<Money, ValueType> get() const { return pair(amount, type); }
         const Date& getDate() const { return day; }
-        const string& getDescription() const { return description; }
+        const string& getDescription() const { return *description; }
+        const shared_ptr<const string>& getSharedDescription() const { return description; }
+        //REQUIRES shared to hold the same text as the current description
+        void shareDescription(const shared_ptr<const string>& shared) { description = shared; }
 };
 
 #endif
\ No newline at end of file
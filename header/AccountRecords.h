@@ -2,27 +2,61 @@
 #define ACCOUNT_RECORDS_H
 
 #include "Date.h"
+#include "Money.h"
 #include "ValueType.h"
 #include "JournalModification.h"
 
+#include <cstdint>
+
+#include <memory>
+using std::unique_ptr;
+
+#include <span>
+using std::span;
+
 #include <vector>
 using std::vector;
 
+using EntryView = span<JournalModification* const>;
+
+//Balances for one period plus a view of its entries. The outermost record owns a single date ordered entry store,
+//nested periods only hold an [firstEntry, lastEntry) range into it
 class AccountRecords {
+    private:
+        unique_ptr<vector<JournalModification*>> ownedEntries; //Only set on the outermost record once it has entries
     protected:
-        double beginningBalance, endingBalance;
+        Money beginningBalance, endingBalance;
         DateUnit year;
         ValueType accountType;
-        AccountRecords(DateUnit year, ValueType accountType, double beginningBalance = 0) : year(year), accountType(accountType), beginningBalance(beginningBalance), endingBalance(beginningBalance) {}
+        const vector<JournalModification*>* store;
+        uint32_t firstEntry, lastEntry;
+        AccountRecords(DateUnit year, ValueType accountType, Money beginningBalance = 0) : year(year), accountType(accountType), beginningBalance(beginningBalance), endingBalance(beginningBalance), store(nullptr), firstEntry(0), lastEntry(0) {}
+        AccountRecords(const AccountRecords&); //A copy of a nested record owns a copy of its range, so it outlives the source's store
+        AccountRecords(AccountRecords&&) = default;
+        AccountRecords& operator=(const AccountRecords&);
+        AccountRecords& operator=(AccountRecords&&) = default;
+
+        vector<JournalModification*>& getStore(); //Creates the owned store on first use, only valid on the outermost record
+        virtual void attachChildren() {} //Points nested periods at this record's store
+        void attachTo(const vector<JournalModification*>* parentStore) { store = parentStore; }
+        //Used when the parent was copied: drops the range this copy took for itself and takes source's range, less offset, in the parent's store
+        virtual void shareParentStore(const AccountRecords& source, uint32_t offset);
+        void insertEntry(vector<JournalModification*>& entries, JournalModification*); //Inserts into this record's range, keeping date order
+        void shiftEntries(uint32_t inserted) { firstEntry += inserted; lastEntry += inserted; } //Moves the range past entries inserted before it
+        //Moves the range back past count entries erased from the front of the store, a range inside them becomes empty
+        void dropFront(uint32_t count) { firstEntry = firstEntry > count ? firstEntry - count : 0; lastEntry = lastEntry > count ? lastEntry - count : 0; }
     public:
+        virtual ~AccountRecords() = default;
         ValueType getValueType() const { return accountType; }
-        double getBeginningBalance() const { return beginningBalance; }
-        double getEndingBalance() const { return endingBalance; }
-        void setBeginningBalance(double bb) { beginningBalance = bb; }
-        void setEndingBalance(double eb) { endingBalance = eb; }
+        Money signedAmount(const JournalModification* entry) const { return (entry->get().second == accountType) ? entry->get().first : -entry->get().first; } //Effect of entry on this balance
+        Money getBeginningBalance() const { return beginningBalance; }
+        Money getEndingBalance() const { return endingBalance; }
+        void setBeginningBalance(Money bb) { beginningBalance = bb; }
+        void setEndingBalance(Money eb) { endingBalance = eb; }
+        void shiftBalances(Money delta) { beginningBalance += delta; endingBalance += delta; } //Applies a change posted to an earlier period
         DateUnit getYear() const { return year; }
         virtual void addEntry(JournalModification*);
-        virtual const vector<JournalModification*>& getEntries() const = 0;
+        EntryView getEntries() const { return store ? EntryView(store->data() + firstEntry, lastEntry - firstEntry) : EntryView(); }
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -5,7 +5,7 @@
 
 class AssetAccount : public Account {
     public:
-        AssetAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::Asset, year, beginningBalance) {}
+        AssetAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::Asset, year, beginningBalance) {}
 };
 
 
@@ -0,0 +1,27 @@
+#ifndef BALANCE_INDEX_H
+#define BALANCE_INDEX_H
+
+#include "Money.h"
+
+#include <span>
+using std::span;
+
+#include <vector>
+using std::vector;
+
+//Binary indexed (Fenwick) tree of net balance changes per day of the year,
+//answering prefix and range sums in O(log days). Storage is allocated on the first change.
+class BalanceIndex {
+    private:
+        vector<Money> tree;
+    public:
+        static constexpr unsigned DAY_SLOTS = 366;
+
+        void add(unsigned dayOfYear, Money delta); //dayOfYear is 0-based
+        void assign(span<const Money> dayChanges); //Replaces every change at once in O(days), dayChanges[d] is day d's net change
+        Money prefixSum(unsigned dayOfYear) const; //Net change over days [0, dayOfYear]
+        Money rangeSum(unsigned firstDay, unsigned lastDay) const; //Net change over days [firstDay, lastDay]
+        bool empty() const { return tree.empty(); }
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef CASE_INSENSITIVE_HASH_H
+#define CASE_INSENSITIVE_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <string_view>
+using std::string_view;
+
+//ASCII upper-casing without the locale lookup std::toupper does per character
+constexpr char asciiUpper(char c) { return (c >= 'a' and c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c; }
+
+//Upper-cases the eight ASCII bytes packed in word at once, bytes outside 'a'-'z' are left alone
+constexpr uint64_t asciiUpperWord(uint64_t word) {
+    constexpr uint64_t ONES = 0x0101010101010101ull;
+    constexpr uint64_t HIGH_BITS = 0x8080808080808080ull;
+    uint64_t low = word & ~HIGH_BITS;
+    uint64_t atLeastA = low + (0x80 - 'a') * ONES;
+    uint64_t aboveZ = low + (0x80 - 'z' - 1) * ONES;
+    uint64_t isLower = atLeastA & ~aboveZ & ~word & HIGH_BITS;
+    return word - (isLower >> 2);
+}
+
+//Packs the final size - pos (< 8) bytes of text into the low end of a word, avoiding a variable-length memcpy call
+inline uint64_t loadTail(string_view text, size_t pos) {
+    uint64_t word = 0;
+    for(size_t shift = 0; pos < text.size(); ++pos, shift += 8) word |= static_cast<uint64_t>(static_cast<unsigned char>(text[pos])) << shift;
+    return word;
+}
+
+//Hashes eight upper-cased bytes per step. is_transparent lets unordered containers keyed by string be probed with a string_view.
+//Deliberately not noexcept: libstdc++ then caches each node's hash, so walking a bucket compares hashes instead of rehashing keys.
+struct CaseInsensitiveHash {
+    using is_transparent = void;
+    size_t operator()(string_view text) const {
+        constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+        uint64_t hash = text.size() * MULTIPLIER;
+        size_t pos = 0;
+        for(; pos + sizeof(uint64_t) <= text.size(); pos += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, text.data() + pos, sizeof(word));
+            hash = (hash ^ asciiUpperWord(word)) * MULTIPLIER;
+            hash ^= hash >> 29;
+        }
+        if(pos < text.size()) hash = (hash ^ asciiUpperWord(loadTail(text, pos))) * MULTIPLIER;
+        hash ^= hash >> 32;
+        hash *= MULTIPLIER;
+        return static_cast<size_t>(hash ^ (hash >> 29));
+    }
+};
+
+struct CaseInsensitiveEqual {
+    using is_transparent = void;
+    bool operator()(string_view lhs, string_view rhs) const noexcept {
+        if(lhs.size() != rhs.size()) return false;
+        size_t pos = 0;
+        for(; pos + sizeof(uint64_t) <= lhs.size(); pos += sizeof(uint64_t)) {
+            uint64_t left, right;
+            std::memcpy(&left, lhs.data() + pos, sizeof(left));
+            std::memcpy(&right, rhs.data() + pos, sizeof(right));
+            if(left != right and asciiUpperWord(left) != asciiUpperWord(right)) return false;
+        }
+        if(pos == lhs.size()) return true;
+        uint64_t left = loadTail(lhs, pos), right = loadTail(rhs, pos);
+        return left == right or asciiUpperWord(left) == asciiUpperWord(right);
+    }
+};
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+
+//CRC-32 (IEEE, as used by zip and ethernet) of size bytes. Pass a previous result as crc to checksum data in pieces.
+uint32_t crc32(const void* data, size_t size, uint32_t crc = 0);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef CLOSING_ENGINE_H
+#define CLOSING_ENGINE_H
+
+#include "AccountLibrary.h"
+#include "JournalEntry.h"
+#include "PostingListener.h"
+
+#include <array>
+using std::array;
+
+//Keeps the balance of every account type summed as entries post, so net income is known without a pass over
+//the chart, and builds the year end closing entry straight from account ids and their exact balances.
+//Totals follow postings made through the JournalEntryPoster it is subscribed to.
+class ClosingEngine : public ChartTotalsListener {
+    private:
+        mutable array<Money, ACCOUNT_TYPE_COUNT> typeBalances; //Per AccountType, sum of balances in each account's normal direction
+        void addToTotals(const Account&, Money change) const override;
+    public:
+        ClosingEngine(AccountLibrary* accounts);
+
+        Money getTypeBalance(AccountType type) const;
+        //Revenues and gains less expenses and losses, each net of its contra accounts
+        Money getNetIncome() const;
+        Money getDividends() const { return getTypeBalance(AccountType::Dividends); }
+        Date getClosingDate() const { return Date(accounts->getYear(), 12, 31); } //Last day of the library's fiscal year
+
+        //Debits each revenue, gain and contra expense, credits each expense, loss, contra revenue and dividends account
+        //by its balance, and takes the difference to retainedEarnings. Accounts already at zero get no line.
+        JournalEntry buildClosingEntry(AccountId retainedEarnings) const;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef COLD_STORE_H
+#define COLD_STORE_H
+
+#include "AccountLibrary.h"
+#include "AccountRecords.h"
+#include "Journal.h"
+
+#include <string>
+using std::string;
+
+#include <vector>
+using std::vector;
+
+//On-disk home for the detail of months compacted out of memory. Each compaction writes one segment file, in
+//JournalLog format, holding the entries of the months it covers. A segment is read back the first time detail
+//for one of its months is asked for and then stays in memory.
+class ColdStore {
+    private:
+        struct Segment {
+            string path;
+            DateUnit firstMonth, lastMonth;
+            bool loaded;
+        };
+        AccountLibrary* accounts;
+        string directory;
+        vector<Segment> segments; //In month order, each starts the month after the previous one ends
+        Journal loaded; //Entries of the segments read back, never applied to accounts
+        vector<vector<JournalModification*>> accountLines; //accountLines[id] is the account's loaded lines in date order
+        void load(Segment&);
+    public:
+        //Segments are written under directory, which must exist, for the year of accounts
+        ColdStore(AccountLibrary* accounts, const string& directory);
+        ColdStore(const ColdStore&) = delete;
+        ColdStore& operator=(const ColdStore&) = delete;
+
+        //Writes the entries of journal dated after getCompactedThrough() through month to a new segment and syncs it.
+        //Nothing is removed from journal, see ProgramManager::compactThrough.
+        //Throws invalid_argument when month does not extend the compacted months or journal was compacted elsewhere.
+        void archive(const Journal& journal, DateUnit month);
+        DateUnit getCompactedThrough() const { return segments.empty() ? 0 : segments.back().lastMonth; }
+        size_t getSegmentCount() const { return segments.size(); }
+        bool isLoaded(DateUnit month) const;
+
+        //The account's lines dated in month, reading the month's segment on first use. Empty for a month not compacted.
+        EntryView getEntries(AccountId, DateUnit month);
+};
+
+#endif
@@ -5,7 +5,7 @@
 
 class ContraAssetAccount : public Account {
     public:
-        ContraAssetAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::credit, AccountType::ContraAsset, year, beginningBalance) {}
+        ContraAssetAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::credit, AccountType::ContraAsset, year, beginningBalance) {}
 };
 
 
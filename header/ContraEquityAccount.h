@@ -5,7 +5,7 @@
 
 class ContraEquityAccount : public Account {
     public:
-        ContraEquityAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::ContraEquity, year, beginningBalance) {}
+        ContraEquityAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::ContraEquity, year, beginningBalance) {}
 };
 
 
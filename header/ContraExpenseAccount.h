@@ -5,7 +5,7 @@
 
 class ContraExpenseAccount : public Account {
     public:
-        ContraExpenseAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::credit, AccountType::ContraExpense, year, beginningBalance) {}
+        ContraExpenseAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::credit, AccountType::ContraExpense, year, beginningBalance) {}
 };
 
 
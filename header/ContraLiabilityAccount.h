@@ -5,7 +5,7 @@
 
 class ContraLiabilityAccount : public Account {
     public:
-        ContraLiabilityAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::ContraLiability, year, beginningBalance) {}
+        ContraLiabilityAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::ContraLiability, year, beginningBalance) {}
 };
 
 
@@ -5,7 +5,7 @@
 
 class ContraRevenueAccount : public Account {
     public:
-        ContraRevenueAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::ContraRevenue, year, beginningBalance) {}
+        ContraRevenueAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::ContraRevenue, year, beginningBalance) {}
 };
 
 
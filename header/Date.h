@@ -1,19 +1,68 @@
 #ifndef DATE_H
 #define DATE_H
 
+#include <cstdint>
+
+#include <compare>
+
+#include <ostream>
+using std::ostream;
+
+#include <stdexcept>
+
 #include <string>
 using std::string;
 
+#include <string_view>
+using std::string_view;
+
 using DateUnit = unsigned short;
 
-struct Date {
-    DateUnit year, month, day;
-    Date(DateUnit year, DateUnit month, DateUnit day) : year(year), month(month), day(day) {}
-    Date(const string&);
-    string stringForm() const;
+//A calendar date packed into one 32-bit ordinal laid out as year | quarter index | month | day,
+//so comparing two packed values orders dates chronologically and period lookups are shifts and masks
+class Date {
+    private:
+        static constexpr unsigned DAY_BITS = 5, MONTH_BITS = 4, QUARTER_BITS = 2;
+        static constexpr unsigned MONTH_SHIFT = DAY_BITS, QUARTER_SHIFT = MONTH_SHIFT + MONTH_BITS, YEAR_SHIFT = QUARTER_SHIFT + QUARTER_BITS;
+        uint32_t packed;
+        static constexpr uint32_t pack(DateUnit year, DateUnit month, DateUnit day) {
+            if(month > 12 or day > 31) throw std::invalid_argument("Date out of range");
+            return (uint32_t(year) << YEAR_SHIFT) | (uint32_t(month == 0 ? 0 : (month - 1) / 3) << QUARTER_SHIFT) | (uint32_t(month) << MONTH_SHIFT) | day;
+        }
+    public:
+        static constexpr size_t STRING_LENGTH = 10; //mm/dd/yyyy
 
-    bool operator==(const Date&) const;
-    bool operator!=(const Date&) const;
+        constexpr Date(DateUnit year, DateUnit month, DateUnit day) : packed(pack(year, month, day)) {}
+        Date(string_view mmddyyyy); //Throws invalid_argument when tryParse would fail
+        static bool tryParse(string_view mmddyyyy, Date& result); //Allocation-free, validates month lengths and leap years
+        char* format(char* buffer) const; //Writes exactly STRING_LENGTH characters (no terminator) for years 0-9999, returns one past the last
+        string stringForm() const;
+
+        static constexpr bool isLeapYear(DateUnit year) { return (year % 4 == 0 and year % 100 != 0) or year % 400 == 0; }
+        static constexpr DateUnit daysInMonth(DateUnit year, DateUnit month) {
+            constexpr DateUnit lengths[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            return (month == 2 and isLeapYear(year)) ? 29 : lengths[month - 1];
+        }
+
+        constexpr DateUnit getYear() const { return packed >> YEAR_SHIFT; }
+        constexpr DateUnit getMonth() const { return (packed >> MONTH_SHIFT) & ((1u << MONTH_BITS) - 1); }
+        constexpr DateUnit getDay() const { return packed & ((1u << DAY_BITS) - 1); }
+        constexpr DateUnit getQuarter() const { return getQuarterIndex() + 1; }
+        constexpr unsigned getQuarterIndex() const { return (packed >> QUARTER_SHIFT) & ((1u << QUARTER_BITS) - 1); } //0-3
+        constexpr unsigned getMonthIndex() const { return getMonth() - 1; } //0-11, position of the month within its year
+        constexpr unsigned getMonthInQuarter() const { return getMonthIndex() - 3 * getQuarterIndex(); } //0-2, position of the month within its quarter
+        constexpr unsigned getDayOfYear() const { //0-365, position of the day within its year
+            constexpr unsigned daysBeforeMonth[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+            return daysBeforeMonth[getMonthIndex()] + (getMonth() > 2 and isLeapYear(getYear()) ? 1 : 0) + getDay() - 1;
+        }
+        constexpr uint32_t getOrdinal() const { return packed; }
+        //REQUIRES an ordinal produced by getOrdinal, ex. one read back from a snapshot
+        static constexpr Date fromOrdinal(uint32_t ordinal) { Date ret(0, 0, 0); ret.packed = ordinal; return ret; }
+
+        constexpr bool operator==(const Date&) const = default;
+        constexpr std::strong_ordering operator<=>(const Date&) const = default;
 };
 
-#endif
\ No newline at end of file
+ostream& operator<<(ostream&, const Date&); //mm/dd/yyyy, formatted in a stack buffer so report rows build no temporary string
+
+#endif
@@ -5,7 +5,7 @@
 
 class DividendsAccount : public Account {
     public:
-        DividendsAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::Dividends, year, beginningBalance) {}
+        DividendsAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::Dividends, year, beginningBalance) {}
 };
 
 
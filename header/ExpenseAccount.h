@@ -5,7 +5,7 @@
 
 class ExpenseAccount : public Account {
     public:
-        ExpenseAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::Expense, year, beginningBalance) {}
+        ExpenseAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::Expense, year, beginningBalance) {}
 };
 
 
@@ -0,0 +1,52 @@
+#ifndef FINANCIAL_STATEMENTS_H
+#define FINANCIAL_STATEMENTS_H
+
+#include "AccountLibrary.h"
+#include "ClosingEngine.h"
+#include "Period.h"
+
+#include <array>
+using std::array;
+
+#include <iostream>
+using std::ostream;
+
+//Statement lines, each contra account type is netted into the category of the account it offsets
+enum class StatementCategory {
+    Assets, Liabilities, Equity, Revenues, Expenses, Gains, Losses, Dividends
+};
+constexpr size_t STATEMENT_CATEGORY_COUNT = static_cast<size_t>(StatementCategory::Dividends) + 1;
+
+enum class PeriodLength {
+    Month, Quarter, Year
+};
+
+//Balance sheet and income statement. Category totals for the year so far come from the per type balances the
+//ClosingEngine keeps current as entries post; statements for a month, quarter or year are read from each account's
+//period records, never from entries.
+class FinancialStatements {
+    private:
+        const AccountLibrary* accounts;
+        const ClosingEngine* closing;
+        //Writes one line per account of the category and returns the category total, change selects activity over ending balances
+        Money renderCategory(ostream&, StatementCategory, PeriodLength, DateUnit index, bool change) const;
+    public:
+        FinancialStatements(const AccountLibrary* accounts, const ClosingEngine* closing) : accounts(accounts), closing(closing) {}
+
+        //Current balance of a category, net of its contra accounts, summed from a handful of type balances
+        Money getTotal(StatementCategory) const;
+        Money getNetIncome() const; //Revenues and gains less expenses and losses for the year so far
+
+        //Period is the index-th month (1-12) or quarter (1-4) of the year, index is ignored for PeriodLength::Year.
+        //Throws invalid_argument for an index outside the year.
+        Period getPeriod(PeriodLength, DateUnit index) const;
+        Money getEndingTotal(StatementCategory, PeriodLength, DateUnit index) const; //Category balance at the end of the period
+        Money getPeriodChange(StatementCategory, PeriodLength, DateUnit index) const; //Category activity within the period
+
+        //Balances at the end of the period, equity includes income not yet closed so the statement balances before closing
+        void renderBalanceSheet(ostream&, PeriodLength, DateUnit index = 1) const;
+        //Activity within the period, a period holding the closing entry shows its nominal accounts closed out
+        void renderIncomeStatement(ostream&, PeriodLength, DateUnit index = 1) const;
+};
+
+#endif
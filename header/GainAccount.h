@@ -5,7 +5,7 @@
 
 class GainAccount : public Account {
     public:
-        GainAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::credit, AccountType::GAIN, year, beginningBalance) {}
+        GainAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::credit, AccountType::GAIN, year, beginningBalance) {}
 };
 
 
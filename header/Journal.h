@@ -3,20 +3,40 @@
 
 #include "Date.h"
 #include "JournalEntry.h"
+#include "LineArena.h"
 
-#include <list>
-using std::list;
+#include <deque>
+using std::deque;
 
 class Journal {
     private:
         DateUnit year;
-        list<JournalEntry> entries;
+        DateUnit frozenMonths; //Months [1, frozenMonths] are compacted and take no more entries
+        LineArena lines; //Every journalized line, entries reference their run of it
+        deque<JournalEntry> entries; //deque so references returned by append stay valid
     public:
-        Journal(const DateUnit &year) : year(year) {}
-        bool journalize(const JournalEntry&);
-        list<JournalEntry> &getEntries() { return entries; }
-        const list<JournalEntry> &getEntries() const { return entries; }
+        Journal(const DateUnit &year) : year(year), frozenMonths(0) {}
+        Journal(const Journal&) = delete; //Entries and accounts point into this journal's arena
+        Journal& operator=(const Journal&) = delete;
+        Journal(Journal&&) = default;
+        Journal& operator=(Journal&&) = default;
+        bool accepts(const JournalEntry& entry) const { return entry.validate() and entry.getDate().getYear() == year and entry.getDate().getMonth() > frozenMonths; }
+        bool journalize(const JournalEntry&); //accepts() then append()
+        bool journalize(JournalEntry&&); //Moves the entry in, left untouched if rejected
+        JournalEntry& append(const JournalEntry&); //REQUIRES accepts(entry), for callers that already checked it
+        JournalEntry& append(JournalEntry&&);
+        //Moves lines straight into the arena as one entry, for bulk loads whose source already guarantees accepts(), see Snapshot::restore.
+        //REQUIRES the lines to balance and to be dated day, in a month not compacted
+        JournalEntry& adopt(const Date& day, shared_ptr<const string> description, span<JournalModification> lines);
+        deque<JournalEntry> &getEntries() { return entries; }
+        const deque<JournalEntry> &getEntries() const { return entries; }
+        const LineArena& getLines() const { return lines; }
         DateUnit getYear() const { return year; }
+        DateUnit getFrozenMonths() const { return frozenMonths; }
+        //Drops every entry dated in months (getFrozenMonths(), month] and frees their lines, later entries in those
+        //months are rejected. References to entries are invalidated. Returns the entries dropped.
+        //REQUIRES nothing to point at the dropped lines, see ProgramManager::compactThrough
+        size_t compactThrough(DateUnit month);
 };
 
 #endif
\ No newline at end of file
@@ -4,25 +4,52 @@
 #include "JournalModification.h"
 #include "Date.h"
 
-#include <list>
-using std::list;
+#include <span>
+using std::span;
+
+#include <vector>
+using std::vector;
 
 #include <string>
 using std::string;
 
+#include <memory>
+using std::shared_ptr;
+
+class Journal;
+
+//An entry under construction owns its lines in a vector. Once journalized it only references
+//the [begin, end) run of lines the journal moved into its arena.
 class JournalEntry {
     private:
-        list<JournalModification> accountsModified;
+        vector<JournalModification> ownedLines;
+        span<JournalModification> lines; //Always views the current lines, owned or in the journal's arena
         Date day;
-        string description;
+        shared_ptr<const string> description; //Every line added is repointed at this one copy
         ValueType lastEntryType;
+        Money imbalance; //Debits minus credits, kept up to date by addModification
+        bool journalized;
+        friend class Journal;
+        void adoptLines(span<JournalModification>); //Drops owned lines for the journal's stored copy
     public:
-        JournalEntry(const Date &day, const string& description) : day(day), description(description), lastEntryType(ValueType::debit) {}
-        void addModification(const JournalModification&);
-        bool validate() const;
+        JournalEntry(const Date &day, const string& description) : day(day), description(std::make_shared<const string>(description)), lastEntryType(ValueType::debit), journalized(false) {}
+        JournalEntry(const Date &day, shared_ptr<const string> description) : day(day), description(std::move(description)), lastEntryType(ValueType::debit), journalized(false) {}
+        //Copies always own their lines, so a copy of a journalized entry can be edited and posted again
+        JournalEntry(const JournalEntry&);
+        JournalEntry& operator=(const JournalEntry&);
+        JournalEntry(JournalEntry&&) noexcept;
+        JournalEntry& operator=(JournalEntry&&) noexcept;
+
+        void addModification(const JournalModification&); //Throws invalid_argument once the entry is journalized
+        void reserveModifications(size_t count) { if(not journalized) { ownedLines.reserve(count); lines = ownedLines; } } //Lets a builder of known size allocate once
+        bool validate() const { return imbalance == 0; } //Balanced state is cached, so this never walks the lines
+        Money getImbalance() const { return imbalance; }
+        bool isJournalized() const { return journalized; }
         const Date& getDate() const { return day; }
-        const string& getDescription() const { return description; }
-        list<JournalModification> &getModifications() { return accountsModified; }
+        const string& getDescription() const { return *description; }
+        const shared_ptr<const string>& getSharedDescription() const { return description; }
+        span<JournalModification> getModifications() { return lines; }
+        span<const JournalModification> getModifications() const { return lines; }
 };
 
-#endif
\ No newline at end of file
+#endif
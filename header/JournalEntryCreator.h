@@ -9,7 +9,9 @@ class JournalEntryCreator {
     public:
         JournalEntryCreator(const Date& day, const string& description) : toCreate(day, description) {}
         void addJournalModification(const JournalModification& modification) { toCreate.addModification(modification); }
+        const shared_ptr<const string>& getSharedDescription() const { return toCreate.getSharedDescription(); }
         const JournalEntry& create() const;
+        JournalEntry release(); //Validates like create() and moves the entry out, the creator is spent afterwards
 };
 
 #endif
\ No newline at end of file
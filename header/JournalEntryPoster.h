@@ -4,14 +4,66 @@
 #include "AccountLibrary.h"
 #include "Journal.h"
 #include "JournalEntry.h"
+#include "JournalLog.h"
+#include "PostingListener.h"
+#include "ThreadPool.h"
+
+#include <chrono>
+#include <cstdint>
+
+#include <span>
+using std::span;
+
+#include <vector>
+using std::vector;
+
+//Counters for the three posting stages: validate the entry, append it to the journal, apply its lines to accounts
+struct PostingStats {
+    uint64_t entriesPosted = 0;
+    uint64_t entriesRejected = 0;
+    uint64_t linesApplied = 0;
+    std::chrono::nanoseconds validateTime{0};
+    std::chrono::nanoseconds appendTime{0};
+    std::chrono::nanoseconds applyTime{0};
+};
 
 class JournalEntryPoster {
     private:
         AccountLibrary* accounts;
         Journal* journal;
+        ThreadPool* pool; //Applies batch groups in parallel when set, not owned
+        JournalLog* log; //Records every journalized entry when set, not owned
+        vector<PostingListener*> listeners; //Not owned, told about each posted entry in posting order
+        PostingStats stats;
+        bool timing; //Stage times cost a clock read each, so they are only gathered on request
+        std::chrono::steady_clock::time_point stageStart;
+        void startStages();
+        void endStage(std::chrono::nanoseconds& total);
+        bool accept(const JournalEntry&); //Validate stage
+        bool apply(JournalEntry&); //Apply stage, on the journal's stored copy
     public:
-        JournalEntryPoster(Journal* journal, AccountLibrary* accounts) : journal(journal), accounts(accounts) {}
+        JournalEntryPoster(Journal* journal, AccountLibrary* accounts) : journal(journal), accounts(accounts), pool(nullptr), log(nullptr), timing(false) {}
+        //With a log set the entry is logged before it is journalized, whatever the log throws propagates with nothing posted
         bool postModification(const JournalEntry&);
+        bool postModification(JournalEntry&&); //Moves the entry into the journal, left untouched if rejected
+        //Posts every acceptable entry of the batch, moving each into the journal, and returns how many were posted.
+        //Lines are grouped by account so each account merges its share of the batch once.
+        //With a thread pool set the groups are applied concurrently, with the same result as serial posting.
+        //When the log throws, the entries before the failing one are still posted in full and the exception propagates.
+        size_t postBatch(span<JournalEntry>);
+        //Moves account's beginning balance by delta in its normal direction and tells listeners, no journal entry is made
+        void shiftBeginningBalance(Account&, Money delta);
+        //Loads lines already in the journal into an account holding no entries, see Account::loadEntries, and tells listeners.
+        //Nothing is validated or appended, so this is for restoring a journal that was posted before, see Snapshot::restore
+        void loadEntries(Account&, span<JournalModification* const> entries);
+
+        void setThreadPool(ThreadPool* threads) { pool = threads; } //nullptr applies batches on the calling thread
+        void setJournalLog(JournalLog* journalLog) { log = journalLog; } //nullptr stops logging
+        void subscribe(PostingListener*);
+        void unsubscribe(PostingListener*);
+        void setTiming(bool enabled) { timing = enabled; }
+        const PostingStats& getStats() const { return stats; }
+        void resetStats() { stats = PostingStats(); }
 };
 
-#endif
\ No newline at end of file
+#endif
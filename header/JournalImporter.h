@@ -0,0 +1,67 @@
+#ifndef JOURNAL_IMPORTER_H
+#define JOURNAL_IMPORTER_H
+
+#include "AccountLibrary.h"
+#include "JournalEntry.h"
+
+#include <cstdint>
+
+#include <istream>
+using std::istream;
+
+#include <string>
+using std::string;
+
+#include <string_view>
+using std::string_view;
+
+#include <vector>
+using std::vector;
+
+class ProgramManager;
+
+struct ImportStats {
+    uint64_t rowsRead = 0;
+    uint64_t entriesPosted = 0;
+    uint64_t entriesRejected = 0; //Unbalanced or outside the journal's year
+};
+
+//Bulk loader for delimited journal files with one line per row:
+//    date (mm/dd/yyyy), entry id, description, dr/cr, account, amount
+//Consecutive rows with the same entry id form one entry, which takes its date and description from its first row.
+//Fields are tokenized in place, quoted fields ("a, b" with "" for a quote) are unescaped only when they hold a quote.
+//A first row whose date field reads "date" is taken as a header. Entries are posted in batches through postEntries.
+//Each import is its own file: header detection and the line numbers in errors start over with it.
+class JournalImporter {
+    private:
+        ProgramManager* program;
+        char delimiter;
+        size_t batchSize;
+        ImportStats stats;
+        vector<JournalEntry> batch;
+        string entryId; //Id of the entry being built, copied since the row it came from may be overwritten by the next read
+        bool buildingEntry;
+        uint64_t lineNumber;
+        vector<string_view> fields;
+        vector<string> unescaped; //Storage for quoted fields that held "", reused row to row
+        void importRows(string_view text); //Entries may continue into the next call
+        void importRow(string_view row);
+        void splitFields(string_view row);
+        void finishEntry();
+        void postBatch();
+    public:
+        static constexpr size_t FIELD_COUNT = 6;
+        static constexpr size_t BLOCK_SIZE = 1 << 20; //Bytes read from a stream at a time
+
+        JournalImporter(ProgramManager* program, char delimiter = ',', size_t batchSize = 4096);
+
+        //Imports every row of text. Throws invalid_argument naming the line for a malformed row, dropping the
+        //entry being built; entries of earlier batches stay posted.
+        void import(string_view text);
+        //Reads the stream in blocks, carrying a partial last row into the next block
+        void import(istream& in);
+        void finish(); //Ends the current entry and posts the partly filled batch, both imports call it before returning
+        const ImportStats& getStats() const { return stats; }
+};
+
+#endif
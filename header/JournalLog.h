@@ -0,0 +1,62 @@
+#ifndef JOURNAL_LOG_H
+#define JOURNAL_LOG_H
+
+#include "Date.h"
+#include "JournalEntry.h"
+
+#include <cstdint>
+
+#include <sys/types.h>
+
+#include <string>
+using std::string;
+
+#include <vector>
+using std::vector;
+
+class AccountLibrary;
+class ProgramManager;
+
+//Append-only binary write-ahead log of journalized entries.
+//File layout: a 12 byte header ("AWAL", format version, year) followed by records of
+//[payload length][CRC-32 of payload][payload], integers in host byte order. A payload is the entry's
+//date, description and lines, each line naming its account by AccountId rather than by name.
+//Records are buffered and written with one fsync per group, so a crash loses at most the unsynced group.
+class JournalLog {
+    private:
+        int descriptor;
+        off_t syncedEnd; //File size once every flushed record is on disk
+        DateUnit year;
+        size_t groupSize; //Records per fsync, 1 syncs every entry
+        size_t pendingRecords;
+        vector<char> pending; //Encoded records not yet written
+        uint64_t syncCount;
+        void encode(const JournalEntry&);
+    public:
+        static constexpr uint32_t FORMAT_VERSION = 1;
+
+        //Creates the log or reopens an existing one, dropping a torn or corrupt tail left by a crash.
+        //Throws invalid_argument for a file that is not a log for this year, runtime_error when the file cannot be used.
+        JournalLog(const string& path, DateUnit year, size_t groupSize = 1);
+        JournalLog(const JournalLog&) = delete;
+        JournalLog& operator=(const JournalLog&) = delete;
+        ~JournalLog(); //Flushes whatever is pending
+
+        //REQUIRES every line's account to belong to an AccountLibrary, the log stores its id.
+        //Throws when the entry cannot be encoded or its group cannot be written, the entry is then left out of the log.
+        void append(const JournalEntry&);
+        //Writes and syncs pending records, the commit point for group commit. When that fails the file is cut back to its
+        //last synced record and the records stay pending, so a later flush retries them.
+        void flush();
+        size_t getPendingRecords() const { return pendingRecords; }
+        uint64_t getSyncCount() const { return syncCount; }
+
+        //Decodes every intact record of the log at path, written for year, into entries built on accounts.
+        //Stops at the first torn or corrupt record. Throws invalid_argument for a line naming an account accounts lacks.
+        static vector<JournalEntry> read(const string& path, DateUnit year, AccountLibrary& accounts);
+        //Replays every intact record of the log at path into manager, which must already hold the chart the log
+        //was written against and no log of its own. Stops at the first torn or corrupt record, returns the entries posted.
+        static size_t recover(const string& path, ProgramManager& manager);
+};
+
+#endif
@@ -9,7 +9,8 @@ class JournalModification : public AccountModification {
     private:
         Account* affectedAccount;
     public:
-        JournalModification(double amount, ValueType type, const Date &day, const string &description, Account* affectedAccount) : AccountModification(amount, type, day, description), affectedAccount(affectedAccount) {}
+        JournalModification(Money amount, ValueType type, const Date &day, const string &description, Account* affectedAccount) : AccountModification(amount, type, day, description), affectedAccount(affectedAccount) {}
+        JournalModification(Money amount, ValueType type, const Date &day, shared_ptr<const string> description, Account* affectedAccount) : AccountModification(amount, type, day, std::move(description)), affectedAccount(affectedAccount) {}
         Account* getAffectedAccount() { return affectedAccount; }
         const Account* getAffectedAccount() const { return affectedAccount; }
 };
@@ -4,6 +4,10 @@
 #include "AccountLibrary.h"
 #include "Date.h"
 #include "JournalModification.h"
+#include "ModificationParser.h"
+
+#include <optional>
+using std::optional;
 
 #include <string>
 using std::string;
@@ -12,10 +16,17 @@ class JournalModificationCreator {
     private:
         AccountLibrary* accounts;
         Date day;
-        string description;
+        shared_ptr<const string> description;
     public:
-        JournalModificationCreator(AccountLibrary* accounts, const Date& date, const string& description) : accounts(accounts), day(date), description(description) {}
-        JournalModification getJournalModification(const string& modification) const;
+        JournalModificationCreator(AccountLibrary* accounts, const Date& date, const string& description) : accounts(accounts), day(date), description(std::make_shared<const string>(description)) {}
+        //Shares an entry's description so the lines created need no copy or compare when added to it
+        JournalModificationCreator(AccountLibrary* accounts, const Date& date, shared_ptr<const string> description) : accounts(accounts), day(date), description(std::move(description)) {}
+        //Form (Dr. or Cr.) <Account Name Here>, amount. Throws invalid_argument naming the problem and its column.
+        JournalModification getJournalModification(string_view modification) const;
+        //Exception and allocation free form: empty when the line does not parse or names no account, parse says why and where
+        optional<JournalModification> tryGetJournalModification(string_view modification, ModificationParse& parse) const;
+        //For callers that resolved the account up front, skips parsing and name lookup entirely
+        JournalModification getJournalModification(ValueType valueType, AccountId account, Money amount) const;
 };
 
 #endif
\ No newline at end of file
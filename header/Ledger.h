@@ -0,0 +1,65 @@
+#ifndef LEDGER_H
+#define LEDGER_H
+
+#include "ProgramManager.h"
+
+#include <deque>
+using std::deque;
+
+#include <memory>
+using std::unique_ptr;
+
+#include <vector>
+using std::vector;
+
+//Books spanning consecutive fiscal years. Each year is a segment holding that year's ProgramManager, found by
+//year - firstYear in O(1). Every year's chart holds the same accounts under the same AccountIds, so an account's
+//history is its sequence of segments. Several years may be open at once so a prior year can take adjustments
+//after rollover; each such posting carries its effect on real accounts into the opening balances of later years.
+class Ledger {
+    private:
+        struct YearSegment {
+            unique_ptr<ProgramManager> program; //Released when the year is compacted
+            vector<Money> endingBalances; //Indexed by AccountId, filled when the year is closed
+            bool closed = false;
+        };
+        DateUnit firstYear;
+        deque<YearSegment> years;
+        YearSegment& getSegment(DateUnit year); //Throws invalid_argument for a year outside the ledger
+        const YearSegment& getSegment(DateUnit year) const;
+        void carryForward(DateUnit year, const JournalEntry&);
+        //Closes whatever nominal balances remain, nothing when all are zero. Throws invalid_argument when the entry is rejected.
+        void postClosingEntry(DateUnit year);
+    public:
+        Ledger(DateUnit firstYear);
+        DateUnit getFirstYear() const { return firstYear; }
+        DateUnit getLastYear() const { return firstYear + years.size() - 1; }
+        bool isOpen(DateUnit year) const { return not getSegment(year).closed; }
+        bool isCompacted(DateUnit year) const { return getSegment(year).program == nullptr; }
+
+        //Throw invalid_argument once the year is compacted. Accounts are only added to the last year's chart,
+        //rollover copies them forward, so an AccountId names the same account in every year that has it.
+        ProgramManager& getProgram(DateUnit year);
+        const ProgramManager& getProgram(DateUnit year) const;
+        AccountLibrary& getAccountLibrary(DateUnit year) { return getProgram(year).getAccountLibrary(); }
+        AccountLibrary& getCurrentAccountLibrary() { return getAccountLibrary(getLastYear()); }
+
+        //Posts into the open year of the entry's date, whose chart its lines must come from.
+        //Throws invalid_argument for a closed or missing year or a line outside that year's chart.
+        bool postEntry(const JournalEntry&);
+
+        //Closes the last year into Retained Earnings and opens the next with real accounts carried at their ending balances
+        //and nominal accounts at zero. The closed out year stays open for adjustments until closeYear.
+        //REQUIRES an account named or aliased Retained Earnings to exist
+        //Throws invalid_argument, leaving the ledger as it was, when the year's journal rejects the closing entry
+        void rollover();
+        //Closes out adjustments made since rollover and stops further posting to the year.
+        //Years close in order and the last year stays open, so year must be the first open year before getLastYear.
+        void closeYear(DateUnit year);
+        //Drops a closed year's entries and records, keeping only each account's ending balance
+        void compactYear(DateUnit year);
+
+        Money getEndingBalance(AccountId, DateUnit year) const; //Available for every year, compacted or not
+};
+
+#endif
@@ -5,7 +5,8 @@
 
 class LedgerModification : public AccountModification {
     public:
-        LedgerModification(double amount, ValueType type, const Date &day, const string& description) : AccountModification(amount, type, day, description) {}
+        LedgerModification(Money amount, ValueType type, const Date &day, const string& description) : AccountModification(amount, type, day, description) {}
+        LedgerModification(Money amount, ValueType type, const Date &day, shared_ptr<const string> description) : AccountModification(amount, type, day, std::move(description)) {}
         bool operator==(const LedgerModification&) const;
 };
 
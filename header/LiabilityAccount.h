@@ -5,7 +5,7 @@
 
 class LiabilityAccount : public Account {
     public:
-        LiabilityAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::credit, AccountType::Liability, year, beginningBalance) {}
+        LiabilityAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::credit, AccountType::Liability, year, beginningBalance) {}
 };
 
 
@@ -0,0 +1,42 @@
+#ifndef LINE_ARENA_H
+#define LINE_ARENA_H
+
+#include "JournalModification.h"
+
+#include <span>
+using std::span;
+
+#include <vector>
+using std::vector;
+
+//Chunked storage for journal lines. Each chunk is reserved up front and never grows past its capacity,
+//so stored lines keep their addresses and every stored run of lines is contiguous.
+class LineArena {
+    private:
+        vector<vector<JournalModification>> chunks;
+        vector<size_t> liveLines; //liveLines[i] is how many lines of chunks[i] have not been released
+        size_t lineCount;
+    public:
+        static constexpr size_t CHUNK_LINES = 4096;
+
+        LineArena() : lineCount(0) {}
+        LineArena(const LineArena&) = delete; //Accounts hold pointers into the chunks
+        LineArena& operator=(const LineArena&) = delete;
+        LineArena(LineArena&&) = default;
+        LineArena& operator=(LineArena&&) = default;
+
+        //Moves lines to the end of the current chunk, or a new one if they do not fit, and returns where they now live
+        span<JournalModification> store(span<JournalModification> lines);
+        span<JournalModification> store(span<const JournalModification> lines); //Copying variant
+        //Gives back runs returned by store that nothing references any more. A chunk whose every line is released
+        //is freed, the last chunk is emptied instead so it keeps taking new lines.
+        //Lines are never moved, so one live line pins its whole chunk: after a release every kept chunk but the last
+        //holds a live line, and at most min(chunks, size() + 1) chunks stay. Runs stored in the order they are later
+        //released, as a journal posted in date order is compacted, leave only the chunk straddling the boundary partly dead.
+        void release(span<const span<const JournalModification>> runs);
+        size_t size() const { return lineCount; }
+        size_t getChunkCount() const { return chunks.size(); }
+        size_t getCapacity() const; //Lines the kept chunks have room for, released and unused slots included
+};
+
+#endif
@@ -5,7 +5,7 @@
 
 class LossAccount : public Account {
     public:
-        LossAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::debit, AccountType::LOSS, year, beginningBalance) {}
+        LossAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::debit, AccountType::LOSS, year, beginningBalance) {}
 };
 
 
@@ -0,0 +1,35 @@
+#ifndef MODIFICATION_PARSER_H
+#define MODIFICATION_PARSER_H
+
+#include "Money.h"
+#include "ValueType.h"
+
+#include <cstddef>
+
+#include <string_view>
+using std::string_view;
+
+enum class ModificationError {
+    None, MissingValueType, UnknownValueType, MissingAccount, MissingSeparator, MissingAmount, InvalidAmount, AmountOutOfRange, ExcessPrecision, TrailingCharacters, UnknownAccount
+};
+
+//Outcome of reading one "(Dr. or Cr.) <account>, amount" line. On failure error says what was wrong and
+//column is the 0-based offset into the line where the problem starts.
+struct ModificationParse {
+    ModificationError error = ModificationError::None;
+    size_t column = 0;
+    ValueType type = ValueType::debit;
+    string_view account; //Trimmed view into the parsed line
+    size_t accountColumn = 0;
+    Money amount;
+
+    bool ok() const { return error == ModificationError::None; }
+    const char* describe() const; //Fixed text for error, never allocates
+};
+
+//Allocation-free and exception-free. The value type is the first word, read by its first letter (d or c, any case).
+//The account runs to the first comma, and the amount is read by Money::tryParse, so it is exact decimal text with at most
+//Money::SCALE_DIGITS significant fraction digits. The line is not checked against any account library.
+ModificationParse parseModification(string_view line);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <cstdint>
+
+#include <string>
+using std::string;
+
+#include <string_view>
+using std::string_view;
+
+#include <ostream>
+using std::ostream;
+
+#include <type_traits>
+
+//Number of decimal digits kept below the currency unit (2 -> cents). Override at compile time to change the scale.
+#ifndef MONEY_SCALE_DIGITS
+#define MONEY_SCALE_DIGITS 2
+#endif
+
+constexpr int64_t powerOfTen(unsigned exponent) { return exponent == 0 ? 1 : 10 * powerOfTen(exponent - 1); }
+
+struct MoneyParse;
+
+//Fixed-point currency amount stored as a signed count of minor units, so all ledger arithmetic is exact integer math
+class Money {
+    private:
+        int64_t minorUnits;
+    public:
+        static constexpr unsigned SCALE_DIGITS = MONEY_SCALE_DIGITS;
+        static constexpr int64_t SCALE = powerOfTen(SCALE_DIGITS);
+
+        constexpr Money() : minorUnits(0) {}
+        //Whole currency units, ex. Money(150) is $150.00
+        template<typename Integral, typename = std::enable_if_t<std::is_integral_v<Integral>>>
+        constexpr Money(Integral wholeUnits) : minorUnits(static_cast<int64_t>(wholeUnits) * SCALE) {}
+
+        static constexpr Money fromMinorUnits(int64_t minorUnits) { Money ret; ret.minorUnits = minorUnits; return ret; }
+        static Money fromDouble(double); //Rounds to the nearest minor unit
+        static Money parse(string_view); //Exact decimal parse of "[-]digits[.digits]", throws invalid_argument
+        static MoneyParse tryParse(string_view); //The same parse, allocation-free and reporting failures instead of throwing
+
+        constexpr int64_t getMinorUnits() const { return minorUnits; }
+        double toDouble() const { return static_cast<double>(minorUnits) / SCALE; }
+        string stringForm() const;
+
+        constexpr Money operator-() const { return fromMinorUnits(-minorUnits); }
+        constexpr Money& operator+=(const Money& rhs) { minorUnits += rhs.minorUnits; return *this; }
+        constexpr Money& operator-=(const Money& rhs) { minorUnits -= rhs.minorUnits; return *this; }
+        friend constexpr Money operator+(Money lhs, const Money& rhs) { return lhs += rhs; }
+        friend constexpr Money operator-(Money lhs, const Money& rhs) { return lhs -= rhs; }
+
+        friend constexpr bool operator==(const Money& lhs, const Money& rhs) { return lhs.minorUnits == rhs.minorUnits; }
+        friend constexpr bool operator!=(const Money& lhs, const Money& rhs) { return lhs.minorUnits != rhs.minorUnits; }
+        friend constexpr bool operator<(const Money& lhs, const Money& rhs) { return lhs.minorUnits < rhs.minorUnits; }
+        friend constexpr bool operator<=(const Money& lhs, const Money& rhs) { return lhs.minorUnits <= rhs.minorUnits; }
+        friend constexpr bool operator>(const Money& lhs, const Money& rhs) { return lhs.minorUnits > rhs.minorUnits; }
+        friend constexpr bool operator>=(const Money& lhs, const Money& rhs) { return lhs.minorUnits >= rhs.minorUnits; }
+};
+
+enum class MoneyParseError {
+    None, InvalidAmount, OutOfRange, ExcessPrecision, TrailingCharacters
+};
+
+//Outcome of Money::tryParse. On failure column is the 0-based offset into the text where the problem starts.
+struct MoneyParse {
+    MoneyParseError error = MoneyParseError::None;
+    size_t column = 0;
+    Money amount;
+
+    bool ok() const { return error == MoneyParseError::None; }
+};
+
+ostream& operator<<(ostream&, const Money&);
+
+#endif
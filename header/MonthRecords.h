@@ -10,14 +10,14 @@
 using std::vector;
 
 class MonthRecords : public AccountRecords {
+    friend class QuarterRecords;
     private:
         DateUnit month;
-        vector<JournalModification*> entries;
+        void recordEntry(JournalModification*, vector<JournalModification*>& entries); //Balances and stores entry in a store owned by this record or a parent
     public:
-        MonthRecords(DateUnit year, DateUnit month, ValueType valueType, double beginningBalance) : AccountRecords(year, valueType, beginningBalance), month(month) {}
+        MonthRecords(DateUnit year, DateUnit month, ValueType valueType, Money beginningBalance) : AccountRecords(year, valueType, beginningBalance), month(month) {}
         DateUnit getMonth() const { return month; }
         void addEntry(JournalModification*);
-        const vector<JournalModification*> &getEntries() const { return entries; }
 };
 
-#endif
\ No newline at end of file
+#endif
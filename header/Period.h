@@ -11,6 +11,7 @@ class Period {
         Period(const Date &startDate, const Date &endDate) : startDate(startDate), endDate(endDate) {}
         Date getStartDate() const { return startDate; }
         Date getEndDate() const { return endDate; }
+        bool contains(const Date& day) const { return startDate <= day and day <= endDate; }
 };
 
 #endif
\ No newline at end of file
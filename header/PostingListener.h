@@ -0,0 +1,39 @@
+#ifndef POSTING_LISTENER_H
+#define POSTING_LISTENER_H
+
+#include "AccountLibrary.h"
+#include "JournalEntry.h"
+
+//Receives every entry a JournalEntryPoster posts, after its lines have been applied to their accounts, and every opening balance it shifts.
+//Lets derived views (running totals, trial balances, statements) stay current without rescanning accounts.
+class PostingListener {
+    public:
+        virtual ~PostingListener() = default;
+        virtual void entryPosted(const JournalEntry&) = 0;
+        //Called after account's beginning balance moved by delta in its normal direction, ex. a prior year adjustment carried forward
+        virtual void beginningBalanceShifted(const Account& account, Money delta) = 0;
+        //Called after entries were loaded into account in bulk, ex. by Snapshot::restore, with change their net effect in its normal direction.
+        //No entryPosted follows for the entries loaded.
+        virtual void entriesLoaded(const Account& account, Money change) = 0;
+};
+
+//Listener keeping running totals over the accounts of one chart. Accounts in the chart when the view is built are counted
+//at their current balance. Accounts added later are counted at their beginning balance the first time the view is updated
+//or read, since whatever is posted to them afterwards still reaches the view through entryPosted.
+class ChartTotalsListener : public PostingListener {
+    private:
+        mutable size_t accountsCounted;
+    protected:
+        AccountLibrary* accounts;
+        ChartTotalsListener(AccountLibrary* accounts) : accountsCounted(0), accounts(accounts) {}
+        //Adds change, in account's normal direction, to the view's totals. Const so reads can count new accounts first.
+        virtual void addToTotals(const Account& account, Money change) const = 0;
+        void countExistingAccounts(); //Called once by the derived constructor, when addToTotals can be dispatched
+        void countNewAccounts() const;
+    public:
+        void entryPosted(const JournalEntry&) override; //Lines for accounts outside the chart are ignored
+        void beginningBalanceShifted(const Account&, Money delta) override;
+        void entriesLoaded(const Account&, Money change) override;
+};
+
+#endif
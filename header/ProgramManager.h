@@ -4,14 +4,27 @@
 #include "AccountLibrary.h"
 #include "Journal.h"
 #include "JournalEntryPoster.h"
+#include "ClosingEngine.h"
+#include "TrialBalance.h"
+#include "FinancialStatements.h"
+#include "ColdStore.h"
 
 class ProgramManager {
     private:
         AccountLibrary accounts;
         Journal journal;
         JournalEntryPoster entryPoster;
+        //Subscribed to entryPoster, declared after accounts so they are built against the empty chart
+        ClosingEngine closing;
+        TrialBalance trialBalance;
+        FinancialStatements statements; //Reads closing's totals, so it needs no subscription of its own
+        ColdStore* cold; //Takes the detail of compacted months when set, not owned
+        friend class Snapshot; //Restores straight into the journal and accounts
     public:
-        ProgramManager(DateUnit year) : accounts(year), journal(year), entryPoster(&journal, &accounts) {}
+        ProgramManager(DateUnit year) : accounts(year), journal(year), entryPoster(&journal, &accounts), closing(&accounts), trialBalance(&accounts), statements(&accounts, &closing), cold(nullptr) {
+            entryPoster.subscribe(&closing);
+            entryPoster.subscribe(&trialBalance);
+        }
 
         AccountLibrary &getAccountLibrary() { return accounts; }
         const AccountLibrary& getAccountLibrary() const { return accounts; }
@@ -19,8 +32,25 @@ class ProgramManager {
         const Journal& getJournal() const { return journal; }
 
         bool postEntry(const JournalEntry& entry) { return entryPoster.postModification(entry); }
+        bool postEntry(JournalEntry&& entry) { return entryPoster.postModification(std::move(entry)); }
+        size_t postEntries(span<JournalEntry> entries) { return entryPoster.postBatch(entries); } //Moves posted entries into the journal
+        //Every entry posted from now on is also written to log, see JournalLog::recover for restoring it
+        void setJournalLog(JournalLog* log) { entryPoster.setJournalLog(log); }
+        void setColdStore(ColdStore* store) { cold = store; }
+        //Archives the entries of months [1, month] to the cold store, then drops them from the journal and the accounts.
+        //Every balance, daily and per period, is kept and those months take no more entries. Returns the entries dropped.
+        //Throws invalid_argument without a cold store or for a month already compacted.
+        size_t compactThrough(DateUnit month);
+        //Opening balance change carried in from an earlier year, see Ledger
+        void shiftBeginningBalance(AccountId id, Money delta) { entryPoster.shiftBeginningBalance(accounts.getAccount(id), delta); }
 
+        const ClosingEngine& getClosingEngine() const { return closing; }
+        TrialBalance& getTrialBalance() { return trialBalance; }
+        const TrialBalance& getTrialBalance() const { return trialBalance; }
+        const FinancialStatements& getStatements() const { return statements; }
+        //Closes revenues, expenses, gains, losses, their contra accounts and dividends into Retained Earnings on 12/31 of the year
         //REQUIRES an account named or aliased Retained Earnings to exist
+        //Throws invalid_argument when the journal rejects the entry, ex. once December has been compacted
         void postClosingEntry();
 };
 
@@ -9,17 +9,29 @@
 using std::vector;
 
 class QuarterRecords : public AccountRecords {
+    friend class YearRecords;
     private:
         DateUnit quarter;
         vector<MonthRecords> months;
-        vector<JournalModification*> quarterRecords;
+        void attachChildren();
+        void shareParentStore(const AccountRecords& source, uint32_t offset);
+        void recordEntry(JournalModification*, vector<JournalModification*>& entries); //Balances and stores entry in a store owned by this record or a parent
+        void shiftPeriod(Money delta, uint32_t inserted); //Moves the quarter and its months past a change posted to an earlier quarter
+        //Accounts for a batch already merged into the store: counts and deltas are per month of this quarter,
+        //insertedBefore and deltaBefore carry the batch's effect on earlier periods and are advanced past this quarter
+        void absorbBatch(const uint32_t counts[3], const Money deltas[3], uint32_t& insertedBefore, Money& deltaBefore);
+        void dropEntries(uint32_t count); //Follows count entries erased from the front of the store
     public:
-        QuarterRecords(DateUnit year, DateUnit quarter, ValueType valueType, double beginningBalance);
+        QuarterRecords(DateUnit year, DateUnit quarter, ValueType valueType, Money beginningBalance);
+        QuarterRecords(const QuarterRecords&);
+        QuarterRecords(QuarterRecords&&) = default;
+        QuarterRecords& operator=(const QuarterRecords&);
+        QuarterRecords& operator=(QuarterRecords&&) = default;
         DateUnit getQuarter() const { return quarter; }
         void addEntry(JournalModification*);
-        const vector<JournalModification*> &getEntries() const { return quarterRecords; }
         const vector<MonthRecords> &getMonthRecords() const { return months; }
-        void adjustPeriodBalances(double newValue); //Sets beginningBalance and endingBalance, only to be used on QuarterRecords objects with no entries
+        void adjustPeriodBalances(Money newValue); //Sets beginningBalance and endingBalance, only to be used on QuarterRecords objects with no entries
+        void shiftPeriodBalances(Money delta); //Shifts the quarter and all of its months by a change posted to an earlier quarter
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -5,7 +5,7 @@
 
 class RevenueAccount : public Account {
     public:
-        RevenueAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::credit, AccountType::Revenue, year, beginningBalance) {}
+        RevenueAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::credit, AccountType::Revenue, year, beginningBalance) {}
 };
 
 
@@ -0,0 +1,82 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "Accounts.h"
+#include "Date.h"
+
+#include <cstdint>
+
+#include <span>
+using std::span;
+
+#include <string>
+using std::string;
+
+#include <string_view>
+using std::string_view;
+
+class ProgramManager;
+
+//Read-only, memory-mapped view of a snapshot file: the account table, the alias table and every journal line,
+//each stored as plain arrays (one per field) that are used in place, so opening costs page faults, not parsing.
+//Strings live in one pool and columns refer to them by offset and length.
+class Snapshot {
+    private:
+        void* mapping;
+        size_t mappedSize;
+        DateUnit year;
+        uint32_t checksum;
+        const char* strings;
+        size_t stringBytes;
+        //Account table, indexed by AccountId
+        span<const uint32_t> accountNameOffsets, accountNameLengths, accountLinkedFrom; //linkedFrom: original of a contra account, or NO_ACCOUNT
+        span<const uint8_t> accountTypes;
+        span<const int64_t> accountBeginningBalances;
+        //Every live name binding, primary names included
+        span<const uint32_t> aliasOffsets, aliasLengths, aliasTargets;
+        //Entry e owns lines [entryLineStarts[e], entryLineStarts[e + 1])
+        span<const uint32_t> entryLineStarts, entryDates, entryDescriptionOffsets, entryDescriptionLengths;
+        span<const uint32_t> lineDates, lineAccounts, lineDescriptionOffsets;
+        span<const int64_t> lineAmounts;
+        span<const uint8_t> lineTypes;
+        string_view pooled(uint32_t offset, uint32_t length) const { return string_view(strings + offset, length); }
+    public:
+        static constexpr uint32_t FORMAT_VERSION = 1;
+
+        //Writes manager's chart and journal to path, replacing any existing file only once the new one is complete
+        static void write(const string& path, const ProgramManager& manager);
+
+        //Maps the snapshot at path, checking only its header and size so no column is read yet.
+        //Throws invalid_argument for a file that is not a snapshot or is truncated, runtime_error when it cannot be read.
+        explicit Snapshot(const string& path);
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        ~Snapshot();
+
+        //Checks the CRC-32 over every column, throws invalid_argument for a damaged file. It reads the whole file,
+        //so call it before trusting a file that may have been damaged since it was written.
+        void verify() const;
+
+        //Rebuilds the chart, journal and every account's records into manager, which must be empty and of the snapshot's year.
+        //Entries were validated when first posted, so they are loaded from the columns as they are, only ids, dates and debit or credit sides are checked.
+        //Returns the number of entries restored.
+        size_t restore(ProgramManager& manager) const;
+
+        DateUnit getYear() const { return year; }
+        size_t getAccountCount() const { return accountTypes.size(); }
+        string_view getAccountName(AccountId id) const { return pooled(accountNameOffsets[id], accountNameLengths[id]); }
+        AccountType getAccountType(AccountId id) const { return AccountType(accountTypes[id]); }
+        size_t getEntryCount() const { return entryDates.size(); }
+        Date getEntryDate(size_t entry) const { return Date::fromOrdinal(entryDates[entry]); }
+        string_view getEntryDescription(size_t entry) const { return pooled(entryDescriptionOffsets[entry], entryDescriptionLengths[entry]); }
+        span<const uint32_t> getEntryLineStarts() const { return entryLineStarts; }
+        size_t getLineCount() const { return lineAmounts.size(); }
+        //Line columns, read in place
+        span<const uint32_t> getLineDates() const { return lineDates; } //Date ordinals, see Date::fromOrdinal
+        span<const int64_t> getLineAmounts() const { return lineAmounts; } //Minor units
+        span<const uint8_t> getLineTypes() const { return lineTypes; } //ValueType
+        span<const uint32_t> getLineAccounts() const { return lineAccounts; }
+        string_view getLineDescription(size_t line) const;
+};
+
+#endif
@@ -5,7 +5,7 @@
 
 class StockholdersEquityAccount : public Account {
     public:
-        StockholdersEquityAccount(const string& name, DateUnit year, double beginningBalance = 0) : Account(name, ValueType::credit, AccountType::StockholdersEquity, year, beginningBalance) {}
+        StockholdersEquityAccount(const string& name, DateUnit year, Money beginningBalance = 0) : Account(name, ValueType::credit, AccountType::StockholdersEquity, year, beginningBalance) {}
 };
 
 
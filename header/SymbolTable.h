@@ -0,0 +1,44 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include "CaseInsensitiveHash.h"
+
+#include <cstdint>
+#include <limits>
+
+#include <deque>
+using std::deque;
+
+#include <string>
+using std::string;
+
+#include <string_view>
+using std::string_view;
+
+#include <unordered_map>
+using std::unordered_map;
+
+//Compact handle for an interned name
+using SymbolId = uint32_t;
+constexpr SymbolId NO_SYMBOL = std::numeric_limits<SymbolId>::max();
+
+//Interns names case-insensitively, handing out dense SymbolIds in first-seen order.
+//Each name is stored once; the lookup map keys are views into that storage.
+class SymbolTable {
+    private:
+        deque<string> names; //deque so the views held by symbols stay valid as names are added
+        unordered_map<string_view, SymbolId, CaseInsensitiveHash, CaseInsensitiveEqual> symbols;
+    public:
+        SymbolTable() = default;
+        SymbolTable(const SymbolTable&);
+        SymbolTable& operator=(const SymbolTable&);
+        SymbolTable(SymbolTable&&) = default;
+        SymbolTable& operator=(SymbolTable&&) = default;
+
+        SymbolId intern(string_view); //Returns the existing symbol when the name is already known
+        SymbolId find(string_view) const; //NO_SYMBOL when the name was never interned
+        const string& getName(SymbolId symbol) const { return names.at(symbol); }
+        size_t size() const { return names.size(); }
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+using std::atomic;
+
+#include <condition_variable>
+using std::condition_variable;
+
+#include <exception>
+using std::exception_ptr;
+
+#include <functional>
+using std::function;
+
+#include <mutex>
+using std::mutex;
+
+#include <thread>
+using std::thread;
+
+#include <vector>
+using std::vector;
+
+#include <cstdint>
+
+//Fixed set of worker threads for data parallel loops. The calling thread works alongside them,
+//so a pool of n threads starts n - 1 workers and a pool of 1 runs everything inline.
+class ThreadPool {
+    private:
+        vector<thread> workers;
+        mutex state; //Guards everything below except nextIndex
+        condition_variable wake, finished;
+        const function<void(size_t)>* job; //Current loop body, only valid while parallelFor runs
+        size_t jobSize;
+        atomic<size_t> nextIndex; //Tasks are claimed one index at a time, so uneven tasks balance themselves
+        unsigned busyWorkers;
+        uint64_t generation; //Bumped per parallelFor so sleeping workers know a new loop started
+        bool stopping;
+        exception_ptr failure; //First exception thrown by any task, rethrown by parallelFor
+        void workerLoop();
+        void runTasks(const function<void(size_t)>& task, size_t count);
+    public:
+        explicit ThreadPool(unsigned threads = thread::hardware_concurrency());
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ~ThreadPool();
+
+        unsigned getThreadCount() const { return static_cast<unsigned>(workers.size()) + 1; }
+        //Calls task(i) for every i in [0, count) across the pool and returns once all calls finish.
+        //Not reentrant: task must not call parallelFor on the same pool.
+        void parallelFor(size_t count, const function<void(size_t)>& task);
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef TRIAL_BALANCE_H
+#define TRIAL_BALANCE_H
+
+#include "AccountLibrary.h"
+#include "JournalEntry.h"
+#include "PostingListener.h"
+
+#include <array>
+using std::array;
+
+#include <mutex>
+using std::mutex;
+
+#include <vector>
+using std::vector;
+
+//Debit and credit columns of a trial balance
+struct TrialBalanceTotals {
+    Money debits;
+    Money credits;
+    bool isBalanced() const { return debits == credits; }
+};
+
+//Trial balance kept current as entries post. Every account's balance sits in the debit or credit column by its sign,
+//each posted line moves its account between columns in O(1), and the column sums are read without touching accounts.
+class TrialBalance : public ChartTotalsListener {
+    private:
+        mutable vector<Money> balances; //balances[id] is the account's balance, debits positive and credits negative
+        mutable array<TrialBalanceTotals, ACCOUNT_TYPE_COUNT> typeTotals;
+        mutable TrialBalanceTotals totals;
+        //Copy of totals taken after each entry, the only state safe to read from a thread other than the posting one
+        mutable mutex publishedLock;
+        mutable TrialBalanceTotals published;
+        void move(AccountType, Money& balance, Money change) const;
+        void addToTotals(const Account&, Money change) const override;
+        void publish() const;
+    public:
+        TrialBalance(AccountLibrary* accounts);
+        void entryPosted(const JournalEntry&) override;
+        void beginningBalanceShifted(const Account&, Money delta) override;
+        void entriesLoaded(const Account&, Money change) override;
+
+        //Column sums as of the last posted entry, O(1) and safe to poll from a monitoring thread
+        TrialBalanceTotals getTotals() const;
+        bool isBalanced() const { return getTotals().isBalanced(); }
+
+        //The following are for the posting thread and also pick up accounts added since the last posting
+        TrialBalanceTotals getTypeTotals(AccountType) const;
+        Money getDebitBalance(AccountId) const; //Zero when the account carries a credit balance
+        Money getCreditBalance(AccountId) const; //Zero when the account carries a debit balance
+};
+
+#endif
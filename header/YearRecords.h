@@ -6,16 +6,28 @@
 #include "JournalModification.h"
 #include "Date.h"
 
+//Owns the account's single date ordered entry store, quarters and months are ranges within it
 class YearRecords : public AccountRecords {
     private:
         vector<QuarterRecords> quarters;
-        vector<JournalModification*> entries;
+        void attachChildren();
     public:
-        YearRecords(DateUnit, ValueType, double);
+        YearRecords(DateUnit, ValueType, Money);
+        YearRecords(const YearRecords&);
+        YearRecords(YearRecords&&) = default;
+        YearRecords& operator=(const YearRecords&);
+        YearRecords& operator=(YearRecords&&) = default;
         void addEntry(JournalModification*);
+        //Same result as calling addEntry on each, but merges them into the store once and updates every period once
+        void addEntries(span<JournalModification* const>);
+        //Fills records that hold no entries yet from entries already in date order, same-day entries in arrival order, without sorting.
+        //Throws invalid_argument otherwise.
+        void loadEntries(span<JournalModification* const>);
+        //Forgets the entries of months [1, month], balances of every period are kept
+        void dropEntriesThrough(DateUnit month);
+        void shiftYearBalances(Money delta); //Shifts the year, its quarters and months by a change to the opening balance
         const vector<QuarterRecords> &getQuarterRecords() const { return quarters; }
-        const vector<JournalModification*> &getEntries() const { return entries; }
         const MonthRecords &getMonthRecords(DateUnit month) const { return quarters[(month-1) / 3].getMonthRecords()[(month-1) % 3]; }
 };
 
-#endif
\ No newline at end of file
+#endif
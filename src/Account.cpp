@@ -1,7 +1,43 @@
 #include "../header/Account.h"
 
+#include <stdexcept>
+using std::invalid_argument;
+
 void Account::addEntry(JournalModification* entry) {
     records.addEntry(entry);
+    dailyChanges.add(entry->getDate().getDayOfYear(), records.signedAmount(entry));
+}
+
+void Account::addEntries(span<JournalModification* const> entries) {
+    records.addEntries(entries);
+    for(const auto entry : entries) {
+        dailyChanges.add(entry->getDate().getDayOfYear(), records.signedAmount(entry));
+    }
+}
+
+void Account::loadEntries(span<JournalModification* const> entries) {
+    records.loadEntries(entries);
+    if(entries.empty()) return;
+    Money dayChanges[BalanceIndex::DAY_SLOTS];
+    for(const auto entry : entries) {
+        dayChanges[entry->getDate().getDayOfYear()] += records.signedAmount(entry);
+    }
+    dailyChanges.assign(dayChanges);
+}
+
+Money Account::getBalanceAsOf(const Date& day) const {
+    if(day.getYear() != year) throw invalid_argument("Balance requested for a year this account does not record");
+    return getBeginningBalance() + dailyChanges.prefixSum(day.getDayOfYear());
+}
+
+Money Account::getBalanceBefore(const Date& day) const {
+    if(day.getYear() != year) throw invalid_argument("Balance requested for a year this account does not record");
+    return day.getDayOfYear() == 0 ? getBeginningBalance() : getBeginningBalance() + dailyChanges.prefixSum(day.getDayOfYear() - 1);
+}
+
+Money Account::getNetChange(const Date& from, const Date& to) const {
+    if(from.getYear() != year or to.getYear() != year) throw invalid_argument("Net change requested for a year this account does not record");
+    return dailyChanges.rangeSum(from.getDayOfYear(), to.getDayOfYear());
 }
 
 bool Account::operator==(const Account& rhs) const {
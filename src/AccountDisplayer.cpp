@@ -11,7 +11,7 @@ using std::ostringstream;
 
 const unsigned DEFAULT_WIDTH = 11;
 
-void displayEntry(ostream&, const JournalModification&);
+void displayEntry(ostream&, const JournalModification&, Money runningBalance);
 
 void AccountDisplayer::display(ostream& toWrite) const {
     toWrite << "---";
@@ -21,22 +21,29 @@ void AccountDisplayer::display(ostream& toWrite) const {
     toWrite << "---" << endl;
     auto precision = toWrite.precision();
     toWrite.precision(2);
-    toWrite << period.getStartDate().stringForm() << "\t" << std::right << std::setw(DEFAULT_WIDTH) << /* std::setfill(6) <<*/ std::fixed << toDisplay->getRecords().getMonthRecords(period.getStartDate().month).getBeginningBalance() << "\t| Beginning Balance" << endl;
-    for(unsigned i = period.getStartDate().month; i <= period.getEndDate().month; ++i) {
-        for(auto it : toDisplay->getMonthsEntries(i)) {
-            displayEntry(toWrite, *it);
+    //Opening balance comes from the account's daily balance index, so only entries inside the period are visited
+    Money runningBalance = toDisplay->getBalanceBefore(period.getStartDate());
+    toWrite << period.getStartDate() << "\t" << std::right << std::setw(DEFAULT_WIDTH) << /* std::setfill(6) <<*/ std::fixed << runningBalance << "\t| Beginning Balance" << endl;
+    for(unsigned i = period.getStartDate().getMonth(); i <= period.getEndDate().getMonth(); ++i) {
+        bool compacted = cold != nullptr and i <= cold->getCompactedThrough();
+        //Each month starts again from the balance index, so months whose lines are gone still carry their net change
+        if(i != period.getStartDate().getMonth()) runningBalance = toDisplay->getBalanceBefore(Date(period.getStartDate().getYear(), i, 1));
+        for(auto it : compacted ? cold->getEntries(toDisplay->getId(), i) : toDisplay->getMonthsEntries(i)) {
+            if(not period.contains(it->getDate())) continue;
+            runningBalance += toDisplay->getRecords().signedAmount(it);
+            displayEntry(toWrite, *it, runningBalance);
         }
     }
-    toWrite << period.getEndDate().stringForm() << "\t" << std::right << std::setw(DEFAULT_WIDTH) << /* std::setfill(6) <<*/ std::fixed << toDisplay->getRecords().getMonthRecords(period.getEndDate().month).getEndingBalance() << "\t| Ending Balance" << endl;
+    toWrite << period.getEndDate() << "\t" << std::right << std::setw(DEFAULT_WIDTH) << /* std::setfill(6) <<*/ std::fixed << toDisplay->getBalanceAsOf(period.getEndDate()) << "\t| Ending Balance" << endl;
     toWrite << endl;
 
     toWrite.precision(precision);
 }
 
 
-void displayEntry(ostream& toWrite, const JournalModification& modification) {
+void displayEntry(ostream& toWrite, const JournalModification& modification, Money runningBalance) {
     //Write date of transaction
-    toWrite << modification.getDate().stringForm() << "\t" << std::right;
+    toWrite << modification.getDate() << "\t" << std::right;
 
     //Write value amount, accounting for whether to include parentheses
     string displayValue = "";
@@ -55,5 +62,8 @@ void displayEntry(ostream& toWrite, const JournalModification& modification) {
     if(modification.get().second != modification.getAffectedAccount()->getBalanceType()) displayValue += ")";
     toWrite << displayValue;
 
+    //Write the account balance after this entry
+    toWrite << "\t" << std::setw(DEFAULT_WIDTH) << runningBalance;
+
     toWrite << "\t| " << modification.getDescription() << endl;
 }
\ No newline at end of file
@@ -6,107 +6,133 @@ using std::string;
 #include <stdexcept>
 using std::invalid_argument;
 
-string AccountLibrary::toUpper(const string& toModify) const {
-    string ret = toModify;
-    for(auto& c : ret) {
-        c = toupper(c);
-    }
-    return ret;
+AccountId AccountLibrary::insertAccount(Account&& account) {
+    AccountId id = static_cast<AccountId>(table.size());
+    typeIndex[account.getAccountType()].push_back(id);
+    account.id = id;
+    table.push_back(std::move(account));
+    contraLinks.push_back(NO_ACCOUNT);
+    return id;
+}
+
+bool AccountLibrary::bindName(string_view name, AccountId id) {
+    SymbolId symbol = symbols.intern(name);
+    if(symbol == symbolTargets.size()) symbolTargets.push_back(NO_ACCOUNT);
+    if(symbolTargets[symbol] != NO_ACCOUNT) return false;
+
+    symbolTargets[symbol] = id;
+    return true;
 }
 
-void AccountLibrary::addAccount(const string& name, AccountType accountType, double beginningBalance) {
+void AccountLibrary::addAccount(const string& name, AccountType accountType, Money beginningBalance) {
+    AccountId id;
     switch(accountType) {
         case AccountType::Asset:
-            assets.push_back(AssetAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &assets.back());
+            id = insertAccount(AssetAccount(name, year, beginningBalance));
             break;
         case AccountType::Liability:
-            liabilities.push_back(LiabilityAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &liabilities.back());
+            id = insertAccount(LiabilityAccount(name, year, beginningBalance));
             break;
         case AccountType::StockholdersEquity:
-            stockholdersEquity.push_back(StockholdersEquityAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &stockholdersEquity.back());
+            id = insertAccount(StockholdersEquityAccount(name, year, beginningBalance));
             break;
         case AccountType::ContraEquity:
-            lessEquity.push_back(ContraEquityAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &lessEquity.back());
+            id = insertAccount(ContraEquityAccount(name, year, beginningBalance));
+            lessEquity.push_back(id);
             break;
         case AccountType::Revenue:
-            revenues.push_back(RevenueAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &revenues.back());
+            id = insertAccount(RevenueAccount(name, year, beginningBalance));
             break;
         case AccountType::Expense:
-            expenses.push_back(ExpenseAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &expenses.back());
+            id = insertAccount(ExpenseAccount(name, year, beginningBalance));
             break;
         case AccountType::GAIN:
-            gains.push_back(GainAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &gains.back());
+            id = insertAccount(GainAccount(name, year, beginningBalance));
             break;
         case AccountType::LOSS:
-            losses.push_back(LossAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &losses.back());
+            id = insertAccount(LossAccount(name, year, beginningBalance));
             break;
         case AccountType::Dividends:
-            dividends.push_back(DividendsAccount(name, year, beginningBalance));
-            nameLinker.emplace(toUpper(name), &dividends.back());
+            id = insertAccount(DividendsAccount(name, year, beginningBalance));
             break;
         default:
-            break;
+            return;
     }
+    bindName(name, id);
+}
+
+AccountId AccountLibrary::getAccountId(string_view alias) const {
+    AccountId id = resolve(symbols.find(alias));
+    if(id == NO_ACCOUNT) throw invalid_argument("No such alias " + string(alias));
+    return id;
+}
+
+Account& AccountLibrary::getAccount(string_view alias) {
+    return table[getAccountId(alias)];
 }
 
-Account& AccountLibrary::getAccount(const string& alias) {
-    if(nameLinker.count(toUpper(alias)) == 0) throw invalid_argument("No such alias " + alias);
-    return *(nameLinker.find(toUpper(alias))->second); 
+const Account& AccountLibrary::getAccount(string_view alias) const {
+    return table[getAccountId(alias)];
 }
 
-const Account& AccountLibrary::getAccount(const string& alias) const { 
-    if(nameLinker.count(toUpper(alias)) == 0) throw invalid_argument("No such alias " + alias);
-    return *(nameLinker.find(toUpper(alias))->second); 
+void AccountLibrary::linkAccount(const string& originalAccount, const string& contraAccount, AccountType accountType, Money beginningBalance) {
+    linkAccount(getAccountId(originalAccount), contraAccount, accountType, beginningBalance);
 }
 
-void AccountLibrary::linkAccount(const string& originalAccount, const string& contraAccount, AccountType accountType, double beginningBalance) {
+void AccountLibrary::linkAccount(AccountId original, const string& contraAccount, AccountType accountType, Money beginningBalance) {
+    if(original >= table.size()) throw invalid_argument("No such account id " + std::to_string(original));
+    //An account keeps its first contra account, a second link only adds the new name as an alias for it
+    if(contraLinks[original] != NO_ACCOUNT) {
+        bindName(contraAccount, contraLinks[original]);
+        return;
+    }
+
+    AccountId contra;
     switch(accountType) {
         case AccountType::ContraAsset:
-            contraLinker.emplace(&getAccount(originalAccount), ContraAssetAccount(contraAccount, year, beginningBalance));
-            nameLinker.emplace(toUpper(contraAccount), findLinked(originalAccount));
+            contra = insertAccount(ContraAssetAccount(contraAccount, year, beginningBalance));
             break;
         case AccountType::ContraLiability:
-            contraLinker.emplace(&getAccount(originalAccount), ContraLiabilityAccount(contraAccount, year, beginningBalance));
-            nameLinker.emplace(toUpper(contraAccount), findLinked(originalAccount));
+            contra = insertAccount(ContraLiabilityAccount(contraAccount, year, beginningBalance));
             break;
         case AccountType::ContraEquity:
-            contraLinker.emplace(&getAccount(originalAccount), ContraEquityAccount(contraAccount, year, beginningBalance));
-            nameLinker.emplace(toUpper(contraAccount), findLinked(originalAccount));
+            contra = insertAccount(ContraEquityAccount(contraAccount, year, beginningBalance));
             break;
         case AccountType::ContraRevenue:
-            contraLinker.emplace(&getAccount(originalAccount), ContraRevenueAccount(contraAccount, year, beginningBalance));
-            nameLinker.emplace(toUpper(contraAccount), findLinked(originalAccount));
+            contra = insertAccount(ContraRevenueAccount(contraAccount, year, beginningBalance));
             break;
         case AccountType::ContraExpense:
-            contraLinker.emplace(&getAccount(originalAccount), ContraExpenseAccount(contraAccount, year, beginningBalance));
-            nameLinker.emplace(toUpper(contraAccount), findLinked(originalAccount));
+            contra = insertAccount(ContraExpenseAccount(contraAccount, year, beginningBalance));
             break;
         default:
-            break;
+            return;
     }
+    contraLinks[original] = contra;
+    bindName(contraAccount, contra);
 }
 
-Account* AccountLibrary::findLinked(const string& name) {
-    if(contraLinker.count(&getAccount(name)) == 0) return nullptr;
+Account* AccountLibrary::findLinked(string_view name) {
+    AccountId contra = contraLinks[getAccountId(name)];
+    if(contra == NO_ACCOUNT) return nullptr;
 
-    return &contraLinker.find(&getAccount(name))->second;
+    return &table[contra];
 }
 
-bool AccountLibrary::addAlias(const string& existingAlias, const string& newAlias) {
-    if(nameLinker.count(toUpper(newAlias)) != 0) return false;
+bool AccountLibrary::addAlias(string_view existingAlias, const string& newAlias) {
+    if(resolve(symbols.find(newAlias)) != NO_ACCOUNT) return false;
 
-    nameLinker.emplace(toUpper(newAlias), &getAccount(existingAlias));
-    return true;
+    return bindName(newAlias, getAccountId(existingAlias));
 }
 
-void AccountLibrary::removeAlias(const string& alias) {
-    nameLinker.erase(toUpper(alias));
-}
\ No newline at end of file
+bool AccountLibrary::addAlias(AccountId id, const string& newAlias) {
+    if(id >= table.size()) throw invalid_argument("No such account id " + std::to_string(id));
+    if(resolve(symbols.find(newAlias)) != NO_ACCOUNT) return false;
+
+    return bindName(newAlias, id);
+}
+
+void AccountLibrary::removeAlias(string_view alias) {
+    //The symbol stays interned so handles resolved earlier keep their meaning, it just stops naming an account
+    SymbolId symbol = symbols.find(alias);
+    if(symbol != NO_SYMBOL) symbolTargets[symbol] = NO_ACCOUNT;
+}
@@ -1,15 +1,57 @@
 #include "../header/AccountRecords.h"
 
+#include <algorithm>
+
 #include <stdexcept>
 using std::invalid_argument;
 
+AccountRecords::AccountRecords(const AccountRecords& other) : beginningBalance(other.beginningBalance), endingBalance(other.endingBalance), year(other.year), accountType(other.accountType), store(nullptr), firstEntry(other.firstEntry), lastEntry(other.lastEntry) {
+    if(other.ownedEntries) {
+        ownedEntries = std::make_unique<vector<JournalModification*>>(*other.ownedEntries);
+    } else if(other.store) { //Nested in another record, whose store the copy must not depend on
+        ownedEntries = std::make_unique<vector<JournalModification*>>(other.store->begin() + other.firstEntry, other.store->begin() + other.lastEntry);
+        firstEntry = 0;
+        lastEntry = static_cast<uint32_t>(ownedEntries->size());
+    }
+    if(ownedEntries) store = ownedEntries.get();
+}
+
+void AccountRecords::shareParentStore(const AccountRecords& source, uint32_t offset) {
+    ownedEntries.reset();
+    store = nullptr;
+    firstEntry = source.firstEntry - offset;
+    lastEntry = source.lastEntry - offset;
+}
+
+AccountRecords& AccountRecords::operator=(const AccountRecords& other) {
+    if(this != &other) {
+        AccountRecords copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
 
 void AccountRecords::addEntry(JournalModification* entry) {
-    if(entry->getDate().year != year) throw invalid_argument("Bad year recorded for ledger entry");
+    if(entry->getDate().getYear() != year) throw invalid_argument("Bad year recorded for ledger entry");
+
+    endingBalance += signedAmount(entry);
+}
+
+vector<JournalModification*>& AccountRecords::getStore() {
+    if(not ownedEntries) {
+        ownedEntries = std::make_unique<vector<JournalModification*>>();
+        store = ownedEntries.get();
+        attachChildren();
+    }
+    return *ownedEntries;
+}
 
-    if(entry->get().second == accountType) {
-        endingBalance += entry->get().first;
+void AccountRecords::insertEntry(vector<JournalModification*>& entries, JournalModification* entry) {
+    auto first = entries.begin() + firstEntry, last = entries.begin() + lastEntry;
+    if(first == last or (*(last - 1))->getDate() <= entry->getDate()) { //In-order postings land at the end of the range without searching
+        entries.insert(last, entry);
     } else {
-        endingBalance -= entry->get().first;
+        entries.insert(std::upper_bound(first, last, entry->getDate(), [](const Date& day, const JournalModification* existing) { return day < existing->getDate(); }), entry);
     }
-}
\ No newline at end of file
+    ++lastEntry;
+}
@@ -0,0 +1,41 @@
+#include "../header/BalanceIndex.h"
+
+#include <algorithm>
+
+#include <stdexcept>
+using std::out_of_range;
+
+void BalanceIndex::add(unsigned dayOfYear, Money delta) {
+    if(dayOfYear >= DAY_SLOTS) throw out_of_range("Day of year outside of balance index");
+    if(tree.empty()) tree.resize(DAY_SLOTS + 1);
+
+    for(unsigned i = dayOfYear + 1; i <= DAY_SLOTS; i += i & (0 - i)) {
+        tree[i] += delta;
+    }
+}
+
+void BalanceIndex::assign(span<const Money> dayChanges) {
+    if(dayChanges.size() > DAY_SLOTS) throw out_of_range("More days than the balance index holds");
+    tree.assign(DAY_SLOTS + 1, Money());
+    std::copy(dayChanges.begin(), dayChanges.end(), tree.begin() + 1);
+    //Each node passes its partial sum up to its parent, which covers it
+    for(unsigned i = 1; i <= DAY_SLOTS; ++i) {
+        unsigned parent = i + (i & (0 - i));
+        if(parent <= DAY_SLOTS) tree[parent] += tree[i];
+    }
+}
+
+Money BalanceIndex::prefixSum(unsigned dayOfYear) const {
+    Money total;
+    if(tree.empty()) return total;
+
+    for(unsigned i = (dayOfYear < DAY_SLOTS ? dayOfYear + 1 : DAY_SLOTS); i > 0; i -= i & (0 - i)) {
+        total += tree[i];
+    }
+    return total;
+}
+
+Money BalanceIndex::rangeSum(unsigned firstDay, unsigned lastDay) const {
+    if(lastDay < firstDay) return Money();
+    return firstDay == 0 ? prefixSum(lastDay) : prefixSum(lastDay) - prefixSum(firstDay - 1);
+}
@@ -0,0 +1,41 @@
+#include "../header/Checksum.h"
+
+#include <array>
+using std::array;
+
+#include <bit>
+
+#include <cstring>
+
+//Slicing-by-8 tables: table[k][b] is the CRC of byte b followed by k zero bytes, so eight bytes are folded per step
+static constexpr array<array<uint32_t, 256>, 8> makeCrcTables() {
+    array<array<uint32_t, 256>, 8> tables{};
+    for(uint32_t i = 0; i < 256; ++i) {
+        uint32_t value = i;
+        for(int bit = 0; bit < 8; ++bit) value = (value & 1) ? (value >> 1) ^ 0xEDB88320u : value >> 1;
+        tables[0][i] = value;
+    }
+    for(uint32_t i = 0; i < 256; ++i) {
+        for(size_t k = 1; k < 8; ++k) tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+    }
+    return tables;
+}
+
+static constexpr array<array<uint32_t, 256>, 8> CRC_TABLES = makeCrcTables();
+
+uint32_t crc32(const void* data, size_t size, uint32_t crc) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+    if constexpr(std::endian::native == std::endian::little) {
+        for(; size >= 8; size -= 8, bytes += 8) {
+            uint32_t low, high;
+            std::memcpy(&low, bytes, 4);
+            std::memcpy(&high, bytes + 4, 4);
+            low ^= crc;
+            crc = CRC_TABLES[7][low & 0xFF] ^ CRC_TABLES[6][(low >> 8) & 0xFF] ^ CRC_TABLES[5][(low >> 16) & 0xFF] ^ CRC_TABLES[4][low >> 24]
+                ^ CRC_TABLES[3][high & 0xFF] ^ CRC_TABLES[2][(high >> 8) & 0xFF] ^ CRC_TABLES[1][(high >> 16) & 0xFF] ^ CRC_TABLES[0][high >> 24];
+        }
+    }
+    for(; size > 0; --size, ++bytes) crc = CRC_TABLES[0][(crc ^ *bytes) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
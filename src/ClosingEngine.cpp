@@ -0,0 +1,55 @@
+#include "../header/ClosingEngine.h"
+
+ClosingEngine::ClosingEngine(AccountLibrary* accounts) : ChartTotalsListener(accounts) {
+    typeBalances.fill(0);
+    countExistingAccounts();
+}
+
+void ClosingEngine::addToTotals(const Account& account, Money change) const {
+    typeBalances[account.getAccountType()] += change;
+}
+
+Money ClosingEngine::getTypeBalance(AccountType type) const {
+    countNewAccounts();
+    return typeBalances[type];
+}
+
+Money ClosingEngine::getNetIncome() const {
+    countNewAccounts();
+    return typeBalances[AccountType::Revenue] - typeBalances[AccountType::ContraRevenue] + typeBalances[AccountType::GAIN]
+        - typeBalances[AccountType::Expense] + typeBalances[AccountType::ContraExpense] - typeBalances[AccountType::LOSS];
+}
+
+JournalEntry ClosingEngine::buildClosingEntry(AccountId retainedEarnings) const {
+    Date day = getClosingDate();
+    JournalEntry entry(day, "CJE");
+    constexpr AccountType DEBITED[] = {Revenue, GAIN, ContraExpense};
+    constexpr AccountType CREDITED[] = {Expense, LOSS, ContraRevenue, Dividends};
+
+    //Retained Earnings takes the difference of the very balances the other lines carry, so the entry always balances
+    size_t lineCount = 1;
+    Money toRetainedEarnings = 0;
+    for(AccountType type : DEBITED) {
+        lineCount += accounts->getAccounts(type).size();
+        for(const Account& account : accounts->getAccounts(type)) toRetainedEarnings += account.getBalance();
+    }
+    for(AccountType type : CREDITED) {
+        lineCount += accounts->getAccounts(type).size();
+        for(const Account& account : accounts->getAccounts(type)) toRetainedEarnings -= account.getBalance();
+    }
+    entry.reserveModifications(lineCount);
+
+    //Entries take every debit before any credit
+    auto closeType = [&](AccountType type, ValueType side) {
+        for(AccountId id : accounts->getAccounts(type).getIds()) {
+            Account& account = accounts->getAccount(id);
+            if(account.getBalance() == 0) continue;
+            entry.addModification(JournalModification(account.getBalance(), side, day, entry.getSharedDescription(), &account));
+        }
+    };
+    for(AccountType type : DEBITED) closeType(type, ValueType::debit);
+    if(toRetainedEarnings < 0) entry.addModification(JournalModification(-toRetainedEarnings, ValueType::debit, day, entry.getSharedDescription(), &accounts->getAccount(retainedEarnings)));
+    for(AccountType type : CREDITED) closeType(type, ValueType::credit);
+    if(toRetainedEarnings > 0) entry.addModification(JournalModification(toRetainedEarnings, ValueType::credit, day, entry.getSharedDescription(), &accounts->getAccount(retainedEarnings)));
+    return entry;
+}
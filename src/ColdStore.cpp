@@ -0,0 +1,68 @@
+#include "../header/ColdStore.h"
+#include "../header/JournalLog.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+ColdStore::ColdStore(AccountLibrary* accounts, const string& directory) : accounts(accounts), directory(directory), loaded(accounts->getYear()) {}
+
+void ColdStore::archive(const Journal& journal, DateUnit month) {
+    DateUnit first = getCompactedThrough() + 1;
+    if(journal.getYear() != accounts->getYear()) throw invalid_argument("Cold store is for " + std::to_string(accounts->getYear()) + ", not " + std::to_string(journal.getYear()));
+    if(journal.getFrozenMonths() != getCompactedThrough()) throw invalid_argument("Journal was compacted through a different cold store");
+    if(month < first or month > 12) throw invalid_argument("Cannot archive through month " + std::to_string(month) + " with " + std::to_string(first - 1) + " already archived");
+
+    string path = directory + "/" + std::to_string(accounts->getYear()) + "-" + std::to_string(first) + "-" + std::to_string(month) + ".cold";
+    std::filesystem::remove(path); //Left by an archive that failed before it was recorded
+    {
+        JournalLog segment(path, accounts->getYear(), SIZE_MAX);
+        for(const JournalEntry& entry : journal.getEntries()) {
+            if(entry.getDate().getMonth() <= month) segment.append(entry);
+        }
+        segment.flush();
+    }
+    segments.push_back(Segment{path, first, month, false});
+}
+
+bool ColdStore::isLoaded(DateUnit month) const {
+    for(const Segment& segment : segments) {
+        if(segment.firstMonth <= month and month <= segment.lastMonth) return segment.loaded;
+    }
+    return false;
+}
+
+void ColdStore::load(Segment& segment) {
+    vector<JournalEntry> entries = JournalLog::read(segment.path, accounts->getYear(), *accounts);
+    if(accountLines.size() < accounts->getAccountCount()) accountLines.resize(accounts->getAccountCount());
+    vector<AccountId> touched;
+    for(JournalEntry& entry : entries) {
+        for(JournalModification& line : loaded.append(std::move(entry)).getModifications()) {
+            AccountId id = line.getAffectedAccount()->getId();
+            if(accountLines[id].empty() or accountLines[id].back()->getDate() > line.getDate()) touched.push_back(id);
+            accountLines[id].push_back(&line);
+        }
+    }
+    //Segments may load in any order and are journal ordered, so only accounts that fell out of date order are sorted
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+    for(AccountId id : touched) {
+        std::stable_sort(accountLines[id].begin(), accountLines[id].end(), [](const JournalModification* lhs, const JournalModification* rhs) { return lhs->getDate() < rhs->getDate(); });
+    }
+    segment.loaded = true;
+}
+
+EntryView ColdStore::getEntries(AccountId id, DateUnit month) {
+    auto segment = std::find_if(segments.begin(), segments.end(), [month](const Segment& it) { return it.firstMonth <= month and month <= it.lastMonth; });
+    if(segment == segments.end()) return EntryView();
+    if(not segment->loaded) load(*segment);
+    if(id >= accountLines.size()) return EntryView();
+
+    const vector<JournalModification*>& lines = accountLines[id];
+    auto first = std::partition_point(lines.begin(), lines.end(), [month](const JournalModification* line) { return line->getDate().getMonth() < month; });
+    auto last = std::partition_point(first, lines.end(), [month](const JournalModification* line) { return line->getDate().getMonth() <= month; });
+    return EntryView(lines.data() + (first - lines.begin()), last - first);
+}
@@ -2,47 +2,58 @@
 
 #include <stdexcept>
 
-using std::to_string;
 using std::invalid_argument;
-using std::stoi;
-
-Date::Date(const string& mmddyyyy) {
-    if(mmddyyyy.length() != 10) throw invalid_argument("not in mm/dd/yyyy format");
-    month = stoi(mmddyyyy.substr(0, 2));
-    if(month < 0 or month > 12) throw invalid_argument("invalid month");
-    if(month != (mmddyyyy[0]-'0') * 10 + (mmddyyyy[1]-'0')) throw invalid_argument("bad month input");
-    day = stoi(mmddyyyy.substr(3, 2));
-    if(day < 0 or day > 31) throw invalid_argument("invalid day");
-    if(day != (mmddyyyy[3]-'0') * 10 + (mmddyyyy[4]-'0')) throw invalid_argument("bad day input");
-    year = stoi(mmddyyyy.substr(6, 4));
-    if(year < 0 or year > 9999) throw invalid_argument("invalid year");
-    if(year != (mmddyyyy[6]-'0') * 1000 + (mmddyyyy[7]-'0') * 100 + (mmddyyyy[8]-'0') * 10 + (mmddyyyy[9]-'0')) throw invalid_argument("bad year input");
-}
 
-string Date::stringForm() const {
-    string output = "";
-    
-    if(month < 10) 
-        output += "0";
-    output += to_string(month) + "/";
-
-    if(day < 10) 
-        output += "0";
-    output += to_string(day) + "/";
-
-    for(int i = 1000; i >= 10; i/=10) {
-        if(year < i) output += "0";
+//Reads count ASCII digits starting at text, returning false on any non-digit
+static bool readDigits(const char* text, unsigned count, unsigned& value) {
+    value = 0;
+    for(unsigned i = 0; i < count; ++i) {
+        unsigned digit = static_cast<unsigned char>(text[i]) - '0';
+        if(digit > 9) return false;
+        value = value * 10 + digit;
     }
-    
-    output += to_string(year);
+    return true;
+}
 
-    return output;
+bool Date::tryParse(string_view mmddyyyy, Date& result) {
+    if(mmddyyyy.length() != STRING_LENGTH or mmddyyyy[2] != '/' or mmddyyyy[5] != '/') return false;
+
+    unsigned month, day, year;
+    if(not readDigits(mmddyyyy.data(), 2, month) or not readDigits(mmddyyyy.data() + 3, 2, day) or not readDigits(mmddyyyy.data() + 6, 4, year)) return false;
+    if(month < 1 or month > 12) return false;
+    if(day < 1 or day > daysInMonth(year, month)) return false;
+
+    result.packed = pack(year, month, day);
+    return true;
 }
 
-bool Date::operator==(const Date& operand) const {
-    return year == operand.year and month == operand.month and day == operand.day;
+Date::Date(string_view mmddyyyy) {
+    if(not tryParse(mmddyyyy, *this)) throw invalid_argument("\"" + string(mmddyyyy) + "\" is not a valid mm/dd/yyyy date");
 }
 
-bool Date::operator!=(const Date& operand) const {
-    return !( *this==operand );
-}
\ No newline at end of file
+char* Date::format(char* buffer) const {
+    unsigned month = getMonth(), day = getDay(), year = getYear();
+
+    buffer[0] = '0' + month / 10;
+    buffer[1] = '0' + month % 10;
+    buffer[2] = '/';
+    buffer[3] = '0' + day / 10;
+    buffer[4] = '0' + day % 10;
+    buffer[5] = '/';
+    buffer[6] = '0' + year / 1000 % 10;
+    buffer[7] = '0' + year / 100 % 10;
+    buffer[8] = '0' + year / 10 % 10;
+    buffer[9] = '0' + year % 10;
+
+    return buffer + STRING_LENGTH;
+}
+
+string Date::stringForm() const {
+    char buffer[STRING_LENGTH];
+    return string(buffer, format(buffer));
+}
+
+ostream& operator<<(ostream& out, const Date& day) {
+    char buffer[Date::STRING_LENGTH];
+    return out.write(buffer, day.format(buffer) - buffer);
+}
@@ -0,0 +1,141 @@
+#include "../header/FinancialStatements.h"
+
+#include <iomanip>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+using std::endl;
+
+const unsigned LABEL_WIDTH = 40;
+const unsigned AMOUNT_WIDTH = 14;
+
+//Where each account type is reported, contra types count against the category they offset
+struct CategoryRule {
+    StatementCategory category;
+    int sign;
+};
+
+static constexpr array<CategoryRule, ACCOUNT_TYPE_COUNT> RULES = {{
+    {StatementCategory::Assets, 1}, {StatementCategory::Liabilities, 1}, {StatementCategory::Equity, 1},
+    {StatementCategory::Revenues, 1}, {StatementCategory::Expenses, 1}, {StatementCategory::Gains, 1},
+    {StatementCategory::Losses, 1}, {StatementCategory::Dividends, 1},
+    {StatementCategory::Assets, -1}, {StatementCategory::Liabilities, -1}, {StatementCategory::Equity, -1},
+    {StatementCategory::Revenues, -1}, {StatementCategory::Expenses, -1}
+}};
+
+static const char* const CATEGORY_NAMES[STATEMENT_CATEGORY_COUNT] = {
+    "Assets", "Liabilities", "Equity", "Revenues", "Expenses", "Gains", "Losses", "Dividends"
+};
+
+static Money signedFor(AccountType type, Money balance) {
+    return RULES[type].sign > 0 ? balance : -balance;
+}
+
+//The account's records for the period, already validated by getPeriod
+static const AccountRecords& periodRecords(const Account& account, PeriodLength length, DateUnit index) {
+    switch(length) {
+        case PeriodLength::Month: return account.getRecords().getMonthRecords(index);
+        case PeriodLength::Quarter: return account.getRecords().getQuarterRecords()[index - 1];
+        default: return account.getRecords();
+    }
+}
+
+Money FinancialStatements::getTotal(StatementCategory category) const {
+    Money total = 0;
+    for(size_t type = 0; type < ACCOUNT_TYPE_COUNT; ++type) {
+        if(RULES[type].category == category) total += signedFor(AccountType(type), closing->getTypeBalance(AccountType(type)));
+    }
+    return total;
+}
+
+Money FinancialStatements::getNetIncome() const {
+    return closing->getNetIncome();
+}
+
+Period FinancialStatements::getPeriod(PeriodLength length, DateUnit index) const {
+    DateUnit year = accounts->getYear();
+    switch(length) {
+        case PeriodLength::Month:
+            if(index < 1 or index > 12) throw invalid_argument("Month " + std::to_string(index) + " is outside the year");
+            return Period(Date(year, index, 1), Date(year, index, Date::daysInMonth(year, index)));
+        case PeriodLength::Quarter:
+            if(index < 1 or index > 4) throw invalid_argument("Quarter " + std::to_string(index) + " is outside the year");
+            return Period(Date(year, index * 3 - 2, 1), Date(year, index * 3, Date::daysInMonth(year, index * 3)));
+        default:
+            return Period(Date(year, 1, 1), Date(year, 12, 31));
+    }
+}
+
+Money FinancialStatements::getEndingTotal(StatementCategory category, PeriodLength length, DateUnit index) const {
+    getPeriod(length, index);
+    Money total = 0;
+    for(size_t type = 0; type < ACCOUNT_TYPE_COUNT; ++type) {
+        if(RULES[type].category != category) continue;
+        for(const Account& account : accounts->getAccounts(AccountType(type))) {
+            total += signedFor(AccountType(type), periodRecords(account, length, index).getEndingBalance());
+        }
+    }
+    return total;
+}
+
+Money FinancialStatements::getPeriodChange(StatementCategory category, PeriodLength length, DateUnit index) const {
+    getPeriod(length, index);
+    Money total = 0;
+    for(size_t type = 0; type < ACCOUNT_TYPE_COUNT; ++type) {
+        if(RULES[type].category != category) continue;
+        for(const Account& account : accounts->getAccounts(AccountType(type))) {
+            const AccountRecords& records = periodRecords(account, length, index);
+            total += signedFor(AccountType(type), records.getEndingBalance() - records.getBeginningBalance());
+        }
+    }
+    return total;
+}
+
+static void writeLine(ostream& toWrite, const string& label, Money amount) {
+    toWrite << std::left << std::setw(LABEL_WIDTH) << label << std::right << std::setw(AMOUNT_WIDTH) << amount << endl;
+}
+
+Money FinancialStatements::renderCategory(ostream& toWrite, StatementCategory category, PeriodLength length, DateUnit index, bool change) const {
+    toWrite << CATEGORY_NAMES[static_cast<size_t>(category)] << endl;
+    Money total = 0;
+    for(size_t type = 0; type < ACCOUNT_TYPE_COUNT; ++type) {
+        if(RULES[type].category != category) continue;
+        for(const Account& account : accounts->getAccounts(AccountType(type))) {
+            const AccountRecords& records = periodRecords(account, length, index);
+            Money amount = signedFor(AccountType(type), change ? records.getEndingBalance() - records.getBeginningBalance() : records.getEndingBalance());
+            total += amount;
+            writeLine(toWrite, "  " + account.getName(), amount);
+        }
+    }
+    writeLine(toWrite, string("Total ") + CATEGORY_NAMES[static_cast<size_t>(category)], total);
+    return total;
+}
+
+void FinancialStatements::renderBalanceSheet(ostream& toWrite, PeriodLength length, DateUnit index) const {
+    Period period = getPeriod(length, index);
+    toWrite << "---BALANCE SHEET AS OF " << period.getEndDate() << "---" << endl;
+
+    renderCategory(toWrite, StatementCategory::Assets, length, index, false);
+    Money liabilitiesAndEquity = renderCategory(toWrite, StatementCategory::Liabilities, length, index, false);
+    liabilitiesAndEquity += renderCategory(toWrite, StatementCategory::Equity, length, index, false);
+    //Nominal accounts hold the year's income until the closing entry moves it to retained earnings
+    Money unclosed = getEndingTotal(StatementCategory::Revenues, length, index) + getEndingTotal(StatementCategory::Gains, length, index)
+        - getEndingTotal(StatementCategory::Expenses, length, index) - getEndingTotal(StatementCategory::Losses, length, index)
+        - getEndingTotal(StatementCategory::Dividends, length, index);
+    writeLine(toWrite, "Income Not Yet Closed", unclosed);
+    writeLine(toWrite, "Total Liabilities and Equity", liabilitiesAndEquity + unclosed);
+    toWrite << endl;
+}
+
+void FinancialStatements::renderIncomeStatement(ostream& toWrite, PeriodLength length, DateUnit index) const {
+    Period period = getPeriod(length, index);
+    toWrite << "---INCOME STATEMENT " << period.getStartDate() << " TO " << period.getEndDate() << "---" << endl;
+
+    Money netIncome = renderCategory(toWrite, StatementCategory::Revenues, length, index, true);
+    netIncome -= renderCategory(toWrite, StatementCategory::Expenses, length, index, true);
+    netIncome += renderCategory(toWrite, StatementCategory::Gains, length, index, true);
+    netIncome -= renderCategory(toWrite, StatementCategory::Losses, length, index, true);
+    writeLine(toWrite, "Net Income", netIncome);
+    toWrite << endl;
+}
@@ -1,11 +1,60 @@
 #include "../header/Journal.h"
 
+#include <stdexcept>
+using std::invalid_argument;
+
+#include <vector>
+using std::vector;
+
 bool Journal::journalize(const JournalEntry& entry) {
-    if(not entry.validate()) return false;
-    if(entry.getDate().year != year) return false;
+    if(not accepts(entry)) return false;
+
+    append(entry);
+    return true;
+}
 
-    entries.push_back(entry);
+bool Journal::journalize(JournalEntry&& entry) {
+    if(not accepts(entry)) return false;
+
+    append(std::move(entry));
     return true;
+}
+
+JournalEntry& Journal::append(const JournalEntry& entry) {
+    span<JournalModification> stored = lines.store(entry.getModifications());
+    entries.push_back(JournalEntry(entry.getDate(), entry.getSharedDescription()));
+    entries.back().imbalance = entry.imbalance;
+    entries.back().lastEntryType = entry.lastEntryType;
+    entries.back().adoptLines(stored);
+    return entries.back();
+}
+
+JournalEntry& Journal::append(JournalEntry&& entry) {
+    span<JournalModification> stored = lines.store(entry.getModifications());
+    entries.push_back(std::move(entry));
+    entries.back().adoptLines(stored);
+    return entries.back();
+}
+
+JournalEntry& Journal::adopt(const Date& day, shared_ptr<const string> description, span<JournalModification> entryLines) {
+    span<JournalModification> stored = lines.store(entryLines);
+    entries.emplace_back(day, std::move(description));
+    if(not stored.empty()) entries.back().lastEntryType = stored.back().get().second;
+    entries.back().adoptLines(stored);
+    return entries.back();
+}
 
-    return false;
-}
\ No newline at end of file
+size_t Journal::compactThrough(DateUnit month) {
+    if(month <= frozenMonths or month > 12) throw invalid_argument("Cannot compact through month " + std::to_string(month) + " with " + std::to_string(frozenMonths) + " already compacted");
+    vector<span<const JournalModification>> released;
+    deque<JournalEntry> kept;
+    for(JournalEntry& entry : entries) {
+        if(entry.getDate().getMonth() <= month) released.push_back(entry.getModifications());
+        else kept.push_back(std::move(entry));
+    }
+    //Moved entries keep referencing their run of the arena, only the released runs go
+    entries = std::move(kept);
+    lines.release(released);
+    frozenMonths = month;
+    return released.size();
+}
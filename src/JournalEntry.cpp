@@ -2,19 +2,49 @@
 #include <stdexcept>
 using std::invalid_argument;
 
+JournalEntry::JournalEntry(const JournalEntry& toCopy) : ownedLines(toCopy.lines.begin(), toCopy.lines.end()), lines(ownedLines), day(toCopy.day), description(toCopy.description), lastEntryType(toCopy.lastEntryType), imbalance(toCopy.imbalance), journalized(false) {}
+
+JournalEntry& JournalEntry::operator=(const JournalEntry& toCopy) {
+    if(this != &toCopy) *this = JournalEntry(toCopy);
+    return *this;
+}
+
+//Moving a vector keeps its buffer, so a view of owned lines stays valid in the new entry
+JournalEntry::JournalEntry(JournalEntry&& toMove) noexcept : ownedLines(std::move(toMove.ownedLines)), lines(toMove.lines), day(toMove.day), description(std::move(toMove.description)), lastEntryType(toMove.lastEntryType), imbalance(toMove.imbalance), journalized(toMove.journalized) {
+    toMove.lines = span<JournalModification>();
+    toMove.imbalance = Money();
+}
+
+JournalEntry& JournalEntry::operator=(JournalEntry&& toMove) noexcept {
+    if(this == &toMove) return *this;
+    ownedLines = std::move(toMove.ownedLines);
+    lines = toMove.lines;
+    day = toMove.day;
+    description = std::move(toMove.description);
+    lastEntryType = toMove.lastEntryType;
+    imbalance = toMove.imbalance;
+    journalized = toMove.journalized;
+    toMove.lines = span<JournalModification>();
+    toMove.imbalance = Money();
+    return *this;
+}
+
+void JournalEntry::adoptLines(span<JournalModification> stored) {
+    ownedLines = vector<JournalModification>();
+    lines = stored;
+    journalized = true;
+}
+
 void JournalEntry::addModification(const JournalModification& modification) {
+    if(journalized) throw invalid_argument("Cannot add modifications to a journalized entry");
     if(modification.getDate() != day) throw invalid_argument("Modification dated " + modification.getDate().stringForm() + " not compatible with entry dated " + day.stringForm());
-    if(modification.getDescription() != description) throw invalid_argument("Description of \"" + modification.getDescription() + "\" does not match with expected description of \"" + description + "\"");
+    //Lines built from the entry's own description skip the string compare
+    if(modification.getSharedDescription() != description and modification.getDescription() != *description) throw invalid_argument("Description of \"" + modification.getDescription() + "\" does not match with expected description of \"" + *description + "\"");
 
     if(lastEntryType == ValueType::credit and modification.get().second != ValueType::credit) throw invalid_argument("Attempting to add debit (or invalid) modification after credit modification(s) entered");
-    accountsModified.push_back(modification);
+    ownedLines.push_back(modification);
+    ownedLines.back().shareDescription(description);
+    lines = ownedLines;
     lastEntryType = modification.get().second;
+    imbalance += (lastEntryType == ValueType::debit) ? modification.get().first : -modification.get().first;
 }
-
-bool JournalEntry::validate() const {
-    double currValue = 0;
-    for(auto it : accountsModified) {
-        currValue += (it.get().second == ValueType::debit) ? it.get().first : -it.get().first;
-    }
-    return currValue == 0;
-}
\ No newline at end of file
@@ -7,4 +7,10 @@ const JournalEntry& JournalEntryCreator::create() const {
     if(not toCreate.validate()) throw runtime_error("Journal Entry not valid");
 
     return toCreate;
+}
+
+JournalEntry JournalEntryCreator::release() {
+    if(not toCreate.validate()) throw runtime_error("Journal Entry not valid");
+
+    return std::move(toCreate);
 }
\ No newline at end of file
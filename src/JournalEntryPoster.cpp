@@ -1,12 +1,137 @@
 #include "../header/JournalEntryPoster.h"
 
-bool JournalEntryPoster::postModification(const JournalEntry& entry) {
-    if(not entry.validate()) return false;
+#include <algorithm>
+#include <exception>
+
+#include <unordered_map>
+using std::unordered_map;
+
+#include <vector>
+using std::vector;
+
+using std::chrono::steady_clock;
+
+void JournalEntryPoster::startStages() {
+    if(timing) stageStart = steady_clock::now();
+}
+
+void JournalEntryPoster::endStage(std::chrono::nanoseconds& total) {
+    if(not timing) return;
+    steady_clock::time_point now = steady_clock::now();
+    total += now - stageStart;
+    stageStart = now;
+}
 
-    if(not journal->journalize(entry)) return false;
+bool JournalEntryPoster::accept(const JournalEntry& entry) {
+    startStages();
+    //The only validation pass: balance is cached on the entry, the journal only checks the year
+    bool accepted = journal->accepts(entry);
+    endStage(stats.validateTime);
+    if(not accepted) ++stats.entriesRejected;
+    return accepted;
+}
 
-    for(std::list<JournalModification>::iterator it = journal->getEntries().back().getModifications().begin(); it != journal->getEntries().back().getModifications().end(); ++it) {
-        it->getAffectedAccount()->addEntry(&(*it));
+bool JournalEntryPoster::apply(JournalEntry& posted) {
+    endStage(stats.appendTime);
+
+    for(auto& it : posted.getModifications()) {
+        it.getAffectedAccount()->addEntry(&it);
     }
+    stats.linesApplied += posted.getModifications().size();
+    for(PostingListener* listener : listeners) listener->entryPosted(posted);
+    endStage(stats.applyTime);
+
+    ++stats.entriesPosted;
     return true;
-}
\ No newline at end of file
+}
+
+bool JournalEntryPoster::postModification(const JournalEntry& entry) {
+    if(not accept(entry)) return false;
+    //Logged before it is journalized, so a log that throws leaves the journal and accounts as they were
+    if(log != nullptr) log->append(entry);
+    return apply(journal->append(entry));
+}
+
+bool JournalEntryPoster::postModification(JournalEntry&& entry) {
+    if(not accept(entry)) return false;
+    if(log != nullptr) log->append(entry);
+    return apply(journal->append(std::move(entry)));
+}
+
+size_t JournalEntryPoster::postBatch(span<JournalEntry> entries) {
+    startStages();
+    vector<bool> accepted(entries.size());
+    for(size_t i = 0; i < entries.size(); ++i) {
+        accepted[i] = journal->accepts(entries[i]);
+        if(not accepted[i]) ++stats.entriesRejected;
+    }
+    endStage(stats.validateTime);
+
+    //Journal order is kept within each account's group, so same-day lines land as serial posting would place them
+    unordered_map<Account*, size_t> groupOf;
+    vector<vector<JournalModification*>> groups;
+    vector<const JournalEntry*> stored; //Only kept when listeners need telling, in journal order
+    size_t posted = 0;
+    std::exception_ptr failure; //A log that throws ends the batch there, entries journalized before it are still applied
+    for(size_t i = 0; i < entries.size(); ++i) {
+        if(not accepted[i]) continue;
+        if(log != nullptr) {
+            try {
+                log->append(entries[i]);
+            } catch(...) {
+                failure = std::current_exception();
+                break;
+            }
+        }
+        JournalEntry& appended = journal->append(std::move(entries[i]));
+        if(not listeners.empty()) stored.push_back(&appended);
+        for(auto& line : appended.getModifications()) {
+            auto group = groupOf.try_emplace(line.getAffectedAccount(), groups.size());
+            if(group.second) groups.emplace_back();
+            groups[group.first->second].push_back(&line);
+        }
+        stats.linesApplied += appended.getModifications().size();
+        ++posted;
+    }
+    endStage(stats.appendTime);
+
+    //Groups touch disjoint accounts, so they can be applied in any order or at once.
+    //Largest first keeps one big account from starting last and leaving the other threads idle.
+    vector<std::pair<Account*, size_t>> order(groupOf.begin(), groupOf.end());
+    std::sort(order.begin(), order.end(), [&](const auto& lhs, const auto& rhs) {
+        return groups[lhs.second].size() > groups[rhs.second].size();
+    });
+    auto applyGroup = [&](size_t i) { order[i].first->addEntries(groups[order[i].second]); };
+    if(pool != nullptr) {
+        pool->parallelFor(order.size(), applyGroup);
+    } else {
+        for(size_t i = 0; i < order.size(); ++i) applyGroup(i);
+    }
+    for(const JournalEntry* entry : stored) {
+        for(PostingListener* listener : listeners) listener->entryPosted(*entry);
+    }
+    endStage(stats.applyTime);
+
+    stats.entriesPosted += posted;
+    if(failure) std::rethrow_exception(failure);
+    return posted;
+}
+
+void JournalEntryPoster::shiftBeginningBalance(Account& account, Money delta) {
+    account.shiftBeginningBalance(delta);
+    for(PostingListener* listener : listeners) listener->beginningBalanceShifted(account, delta);
+}
+
+void JournalEntryPoster::loadEntries(Account& account, span<JournalModification* const> entries) {
+    account.loadEntries(entries);
+    stats.linesApplied += entries.size();
+    for(PostingListener* listener : listeners) listener->entriesLoaded(account, account.getBalance() - account.getBeginningBalance());
+}
+
+void JournalEntryPoster::subscribe(PostingListener* listener) {
+    if(std::find(listeners.begin(), listeners.end(), listener) == listeners.end()) listeners.push_back(listener);
+}
+
+void JournalEntryPoster::unsubscribe(PostingListener* listener) {
+    listeners.erase(std::remove(listeners.begin(), listeners.end(), listener), listeners.end());
+}
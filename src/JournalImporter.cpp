@@ -0,0 +1,165 @@
+#include "../header/JournalImporter.h"
+#include "../header/ProgramManager.h"
+
+#include <cctype>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+static string_view trim(string_view field) {
+    while(not field.empty() and (field.front() == ' ' or field.front() == '\t')) field.remove_prefix(1);
+    while(not field.empty() and (field.back() == ' ' or field.back() == '\t' or field.back() == '\r')) field.remove_suffix(1);
+    return field;
+}
+
+static bool equalsIgnoringCase(string_view text, string_view lower) {
+    if(text.size() != lower.size()) return false;
+    for(size_t i = 0; i < text.size(); ++i) {
+        if(std::tolower(static_cast<unsigned char>(text[i])) != lower[i]) return false;
+    }
+    return true;
+}
+
+JournalImporter::JournalImporter(ProgramManager* program, char delimiter, size_t batchSize) : program(program), delimiter(delimiter), batchSize(batchSize == 0 ? 1 : batchSize), buildingEntry(false), lineNumber(0) {
+    fields.reserve(FIELD_COUNT);
+}
+
+void JournalImporter::splitFields(string_view row) {
+    fields.clear();
+    size_t unescapedUsed = 0;
+    size_t position = 0;
+    while(true) {
+        size_t start = position;
+        while(start < row.size() and row[start] == ' ') ++start;
+        if(start < row.size() and row[start] == '"') {
+            //Quoted field: runs to the closing quote, "" inside stands for one quote
+            size_t close = start + 1;
+            bool escaped = false;
+            while(true) {
+                close = row.find('"', close);
+                if(close == string_view::npos) throw invalid_argument("Unterminated quoted field");
+                if(close + 1 < row.size() and row[close + 1] == '"') {
+                    escaped = true;
+                    close += 2;
+                    continue;
+                }
+                break;
+            }
+            string_view quoted = row.substr(start + 1, close - start - 1);
+            if(escaped) {
+                if(unescapedUsed == unescaped.size()) unescaped.emplace_back();
+                string& storage = unescaped[unescapedUsed++];
+                storage.clear();
+                for(size_t i = 0; i < quoted.size(); ++i) {
+                    storage.push_back(quoted[i]);
+                    if(quoted[i] == '"') ++i;
+                }
+                quoted = storage;
+            }
+            fields.push_back(quoted);
+            position = row.find(delimiter, close + 1);
+            if(not trim(row.substr(close + 1, position == string_view::npos ? string_view::npos : position - close - 1)).empty()) throw invalid_argument("Text after a quoted field");
+        } else {
+            position = row.find(delimiter, start);
+            fields.push_back(trim(row.substr(start, position == string_view::npos ? string_view::npos : position - start)));
+        }
+        if(position == string_view::npos) break;
+        ++position;
+    }
+}
+
+void JournalImporter::finishEntry() {
+    buildingEntry = false;
+    if(batch.size() >= batchSize) postBatch();
+}
+
+void JournalImporter::postBatch() {
+    if(batch.empty()) return;
+    size_t posted = program->postEntries(batch);
+    stats.entriesPosted += posted;
+    stats.entriesRejected += batch.size() - posted;
+    batch.clear();
+}
+
+void JournalImporter::importRow(string_view row) {
+    ++lineNumber;
+    if(trim(row).empty()) return;
+    splitFields(row);
+    if(fields.size() != FIELD_COUNT) throw invalid_argument("Expected " + std::to_string(FIELD_COUNT) + " fields, found " + std::to_string(fields.size()));
+    if(lineNumber == 1 and equalsIgnoringCase(fields[0], "date")) return;
+    ++stats.rowsRead;
+
+    //The previous entry is complete once a row names another id, whether or not this row turns out valid
+    if(buildingEntry and fields[1] != entryId) finishEntry();
+
+    Date day(2000, 1, 1);
+    if(not Date::tryParse(fields[0], day)) throw invalid_argument("\"" + string(fields[0]) + "\" is not a valid mm/dd/yyyy date");
+    ValueType type;
+    if(not fields[3].empty() and std::toupper(static_cast<unsigned char>(fields[3][0])) == 'D') type = ValueType::debit;
+    else if(not fields[3].empty() and std::toupper(static_cast<unsigned char>(fields[3][0])) == 'C') type = ValueType::credit;
+    else throw invalid_argument("\"" + string(fields[3]) + "\" is neither dr nor cr");
+    Money amount = Money::parse(fields[5]);
+    //Looked up in the library every row, its symbol table already hashes the view without allocating and follows alias changes
+    Account& account = program->getAccountLibrary().getAccount(fields[4]);
+
+    if(not buildingEntry) {
+        entryId.assign(fields[1]);
+        batch.emplace_back(day, string(fields[2]));
+        batch.back().reserveModifications(2); //A balanced entry has at least a debit and a credit
+        buildingEntry = true;
+    }
+    JournalEntry& entry = batch.back();
+    entry.addModification(JournalModification(amount, type, day, entry.getSharedDescription(), &account));
+}
+
+void JournalImporter::importRows(string_view text) {
+    size_t start = 0;
+    while(start < text.size()) {
+        size_t end = text.find('\n', start);
+        if(end == string_view::npos) end = text.size();
+        try {
+            importRow(text.substr(start, end - start));
+        } catch(const invalid_argument& error) {
+            //The entry being built is dropped so a caller that catches can keep importing
+            if(buildingEntry) batch.pop_back();
+            buildingEntry = false;
+            throw invalid_argument("Line " + std::to_string(lineNumber) + ": " + error.what());
+        }
+        start = end + 1;
+    }
+}
+
+void JournalImporter::import(string_view text) {
+    lineNumber = 0;
+    importRows(text);
+    finish();
+}
+
+void JournalImporter::import(istream& in) {
+    lineNumber = 0;
+    string buffer;
+    size_t carried = 0;
+    while(true) {
+        buffer.resize(carried + BLOCK_SIZE);
+        in.read(buffer.data() + carried, BLOCK_SIZE);
+        size_t filled = carried + static_cast<size_t>(in.gcount());
+        //A read that exactly drains the stream does not set eof, the next one then comes back empty
+        bool atEnd = in.eof() or filled == carried;
+        if(filled == 0) break;
+
+        //Rows are only handed on once complete, the tail after the last newline waits for the next block
+        size_t lastNewline = string_view(buffer.data(), filled).rfind('\n');
+        size_t complete = lastNewline == string_view::npos ? 0 : lastNewline + 1;
+        if(atEnd) complete = filled;
+        importRows(string_view(buffer.data(), complete));
+        buffer.erase(0, complete);
+        carried = filled - complete;
+        if(atEnd) break;
+    }
+    finish();
+}
+
+void JournalImporter::finish() {
+    buildingEntry = false;
+    postBatch();
+}
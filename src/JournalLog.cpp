@@ -0,0 +1,240 @@
+#include "../header/JournalLog.h"
+#include "../header/Checksum.h"
+#include "../header/ProgramManager.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <stdexcept>
+using std::invalid_argument;
+using std::runtime_error;
+
+static constexpr char MAGIC[4] = {'A', 'W', 'A', 'L'};
+static constexpr size_t HEADER_SIZE = sizeof(MAGIC) + 2 * sizeof(uint32_t);
+static constexpr size_t RECORD_PREFIX_SIZE = 2 * sizeof(uint32_t);
+
+static void failWith(const string& what) {
+    throw runtime_error(what + ": " + std::strerror(errno));
+}
+
+template<typename T>
+static void put(vector<char>& out, T value) {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+//Reads a T at position if it fits before end, advancing position
+template<typename T>
+static bool take(const char*& position, const char* end, T& value) {
+    if(static_cast<size_t>(end - position) < sizeof(T)) return false;
+    std::memcpy(&value, position, sizeof(T));
+    position += sizeof(T);
+    return true;
+}
+
+static vector<char> readFile(int descriptor) {
+    vector<char> contents;
+    if(lseek(descriptor, 0, SEEK_SET) < 0) failWith("Cannot seek journal log");
+    char block[1 << 16];
+    ssize_t got;
+    while((got = read(descriptor, block, sizeof(block))) > 0) contents.insert(contents.end(), block, block + got);
+    if(got < 0) failWith("Cannot read journal log");
+    return contents;
+}
+
+static void writeAll(int descriptor, const char* data, size_t size) {
+    while(size > 0) {
+        ssize_t wrote = write(descriptor, data, size);
+        if(wrote < 0) {
+            if(errno == EINTR) continue;
+            failWith("Cannot write journal log");
+        }
+        data += wrote;
+        size -= wrote;
+    }
+}
+
+//Checks the file header, throws invalid_argument when it is not a log of the given year
+static void checkHeader(const vector<char>& contents, DateUnit year) {
+    const char* position = contents.data() + sizeof(MAGIC);
+    const char* end = contents.data() + contents.size();
+    uint32_t version = 0, loggedYear = 0;
+    if(contents.size() < HEADER_SIZE or std::memcmp(contents.data(), MAGIC, sizeof(MAGIC)) != 0) throw invalid_argument("Not a journal log");
+    take(position, end, version);
+    take(position, end, loggedYear);
+    if(version != JournalLog::FORMAT_VERSION) throw invalid_argument("Unsupported journal log version " + std::to_string(version));
+    if(loggedYear != year) throw invalid_argument("Journal log is for " + std::to_string(loggedYear) + ", not " + std::to_string(year));
+}
+
+//Calls visit(payload, size) for each intact record after the header, returns the offset just past the last one
+template<typename Visit>
+static size_t forEachRecord(const vector<char>& contents, Visit visit) {
+    size_t offset = HEADER_SIZE;
+    while(true) {
+        const char* position = contents.data() + offset;
+        const char* end = contents.data() + contents.size();
+        uint32_t length = 0, checksum = 0;
+        if(not take(position, end, length) or not take(position, end, checksum)) break;
+        if(static_cast<size_t>(end - position) < length or crc32(position, length) != checksum) break;
+        visit(position, length);
+        offset += RECORD_PREFIX_SIZE + length;
+    }
+    return offset;
+}
+
+JournalLog::JournalLog(const string& path, DateUnit year, size_t groupSize) : syncedEnd(0), year(year), groupSize(groupSize == 0 ? 1 : groupSize), pendingRecords(0), syncCount(0) {
+    descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(descriptor < 0) failWith("Cannot open journal log " + path);
+
+    try {
+        vector<char> contents = readFile(descriptor);
+        off_t validEnd;
+        if(contents.empty()) {
+            vector<char> header(MAGIC, MAGIC + sizeof(MAGIC));
+            put(header, FORMAT_VERSION);
+            put(header, uint32_t(year));
+            writeAll(descriptor, header.data(), header.size());
+            if(fsync(descriptor) != 0) failWith("Cannot sync journal log");
+            validEnd = HEADER_SIZE;
+        } else {
+            checkHeader(contents, year);
+            validEnd = forEachRecord(contents, [](const char*, uint32_t) {});
+            //New records go after the last intact one, never after garbage a reader would stop at
+            if(static_cast<size_t>(validEnd) != contents.size() and ftruncate(descriptor, validEnd) != 0) failWith("Cannot truncate journal log");
+        }
+        if(lseek(descriptor, validEnd, SEEK_SET) < 0) failWith("Cannot seek journal log");
+        syncedEnd = validEnd;
+    } catch(...) {
+        close(descriptor);
+        throw;
+    }
+}
+
+JournalLog::~JournalLog() {
+    try {
+        flush();
+    } catch(...) {
+        //Destructors cannot report the failure, the records are lost as if the process had crashed
+    }
+    close(descriptor);
+}
+
+void JournalLog::encode(const JournalEntry& entry) {
+    size_t start = pending.size();
+    put(pending, uint32_t(0)); //Length and checksum are filled in once the payload is known
+    put(pending, uint32_t(0));
+
+    put(pending, uint16_t(entry.getDate().getYear()));
+    put(pending, uint8_t(entry.getDate().getMonth()));
+    put(pending, uint8_t(entry.getDate().getDay()));
+    put(pending, uint32_t(entry.getDescription().size()));
+    pending.insert(pending.end(), entry.getDescription().begin(), entry.getDescription().end());
+    put(pending, uint32_t(entry.getModifications().size()));
+    for(const auto& line : entry.getModifications()) {
+        AccountId account = line.getAffectedAccount()->getId();
+        if(account == NO_ACCOUNT) throw invalid_argument("Cannot log a line for an account outside any library");
+        put(pending, line.get().first.getMinorUnits());
+        put(pending, uint8_t(line.get().second));
+        put(pending, account);
+    }
+
+    size_t payload = start + RECORD_PREFIX_SIZE;
+    uint32_t length = static_cast<uint32_t>(pending.size() - payload);
+    uint32_t checksum = crc32(pending.data() + payload, length);
+    std::memcpy(pending.data() + start, &length, sizeof(length));
+    std::memcpy(pending.data() + start + sizeof(length), &checksum, sizeof(checksum));
+}
+
+void JournalLog::append(const JournalEntry& entry) {
+    size_t before = pending.size();
+    try {
+        encode(entry);
+    } catch(...) {
+        pending.resize(before);
+        throw;
+    }
+    if(++pendingRecords >= groupSize) {
+        try {
+            flush();
+        } catch(...) {
+            pending.resize(before);
+            --pendingRecords;
+            throw;
+        }
+    }
+}
+
+void JournalLog::flush() {
+    if(pendingRecords == 0) return;
+    try {
+        writeAll(descriptor, pending.data(), pending.size());
+        if(fdatasync(descriptor) != 0) failWith("Cannot sync journal log");
+    } catch(...) {
+        //Whatever part of the group reached the file is cut, so the next write follows the last synced record
+        if(ftruncate(descriptor, syncedEnd) == 0) lseek(descriptor, syncedEnd, SEEK_SET);
+        throw;
+    }
+    syncedEnd += pending.size();
+    ++syncCount;
+    pending.clear();
+    pendingRecords = 0;
+}
+
+vector<JournalEntry> JournalLog::read(const string& path, DateUnit year, AccountLibrary& accounts) {
+    int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(descriptor < 0) failWith("Cannot open journal log " + path);
+    vector<char> contents;
+    try {
+        contents = readFile(descriptor);
+    } catch(...) {
+        close(descriptor);
+        throw;
+    }
+    close(descriptor);
+
+    checkHeader(contents, year);
+    vector<JournalEntry> entries;
+    bool intact = true;
+    forEachRecord(contents, [&](const char* position, uint32_t length) {
+        const char* end = position + length;
+        uint16_t entryYear;
+        uint8_t month, day;
+        uint32_t descriptionLength, lineCount;
+        //A record that passed its checksum but does not decode was written by something else, replay stops there
+        if(not intact or not take(position, end, entryYear) or not take(position, end, month) or not take(position, end, day)
+            or not take(position, end, descriptionLength) or static_cast<size_t>(end - position) < descriptionLength) {
+            intact = false;
+            return;
+        }
+        Date date(entryYear, month, day);
+        JournalEntry entry(date, string(position, descriptionLength));
+        position += descriptionLength;
+        if(not take(position, end, lineCount)) {
+            intact = false;
+            return;
+        }
+        entry.reserveModifications(lineCount);
+        for(uint32_t i = 0; i < lineCount; ++i) {
+            int64_t minorUnits;
+            uint8_t type;
+            AccountId account;
+            if(not take(position, end, minorUnits) or not take(position, end, type) or not take(position, end, account)) {
+                intact = false;
+                return;
+            }
+            if(account >= accounts.getAccountCount()) throw invalid_argument("Journal log names account " + std::to_string(account) + " missing from the chart");
+            entry.addModification(JournalModification(Money::fromMinorUnits(minorUnits), ValueType(type), date, entry.getSharedDescription(), &accounts.getAccount(account)));
+        }
+        entries.push_back(std::move(entry));
+    });
+
+    return entries;
+}
+
+size_t JournalLog::recover(const string& path, ProgramManager& manager) {
+    vector<JournalEntry> entries = read(path, manager.getJournal().getYear(), manager.getAccountLibrary());
+    return manager.postEntries(entries);
+}
@@ -3,36 +3,26 @@
 #include <stdexcept>
 using std::invalid_argument;
 
-#include <sstream>
-using std::basic_istringstream;
-using std::string;
-
-JournalModification JournalModificationCreator::getJournalModification(const string& modification) const {
-    //Form (Dr. or Cr.) <Account Name Here>, amount
-    ValueType valueType = ValueType::debit;
-    string accountIdentifier = "";
-    double amount = 0;
-    basic_istringstream modificationParser(modification);
-
-    string buffer = "";
-    modificationParser >> buffer;
-
-    switch(toupper(buffer[0])) {
-        case 'D':
-            valueType = ValueType::debit;
-            break;
-        case 'C':
-            valueType = ValueType::credit;
-            break;
-        default:
-            throw invalid_argument("Invalid value type in journal modification");
-            break;
+optional<JournalModification> JournalModificationCreator::tryGetJournalModification(string_view modification, ModificationParse& parse) const {
+    parse = parseModification(modification);
+    if(not parse.ok()) return std::nullopt;
+
+    AccountId account = accounts->resolve(accounts->findSymbol(parse.account));
+    if(account == NO_ACCOUNT) {
+        parse.error = ModificationError::UnknownAccount;
+        parse.column = parse.accountColumn;
+        return std::nullopt;
     }
-
-    getline(modificationParser >> std::ws, accountIdentifier, ',');
-
-    modificationParser >> amount;
-    if(modificationParser.fail()) throw invalid_argument("Could not read total value change in journal modification");
-
-    return JournalModification(amount, valueType, day, description, &accounts->getAccount(accountIdentifier));
-}
\ No newline at end of file
+    return JournalModification(parse.amount, parse.type, day, description, &accounts->getAccount(account));
+}
+
+JournalModification JournalModificationCreator::getJournalModification(string_view modification) const {
+    ModificationParse parse;
+    optional<JournalModification> created = tryGetJournalModification(modification, parse);
+    if(not created) throw invalid_argument(string(parse.describe()) + " at column " + std::to_string(parse.column + 1) + " of \"" + string(modification) + "\"");
+    return *std::move(created);
+}
+
+JournalModification JournalModificationCreator::getJournalModification(ValueType valueType, AccountId account, Money amount) const {
+    return JournalModification(amount, valueType, day, description, &accounts->getAccount(account));
+}
@@ -0,0 +1,133 @@
+#include "../header/Ledger.h"
+
+#include <stdexcept>
+using std::invalid_argument;
+
+//Balance sheet accounts keep their balance across years, the rest are closed to Retained Earnings
+static bool isRealAccount(AccountType type) {
+    switch(type) {
+        case Asset: case Liability: case StockholdersEquity: case ContraAsset: case ContraLiability: case ContraEquity: return true;
+        default: return false;
+    }
+}
+
+Ledger::Ledger(DateUnit firstYear) : firstYear(firstYear) {
+    years.emplace_back();
+    years.back().program = std::make_unique<ProgramManager>(firstYear);
+}
+
+Ledger::YearSegment& Ledger::getSegment(DateUnit year) {
+    if(year < firstYear or year > getLastYear()) throw invalid_argument("The ledger holds no year " + std::to_string(year));
+    return years[year - firstYear];
+}
+
+const Ledger::YearSegment& Ledger::getSegment(DateUnit year) const {
+    if(year < firstYear or year > getLastYear()) throw invalid_argument("The ledger holds no year " + std::to_string(year));
+    return years[year - firstYear];
+}
+
+ProgramManager& Ledger::getProgram(DateUnit year) {
+    YearSegment& segment = getSegment(year);
+    if(segment.program == nullptr) throw invalid_argument("Year " + std::to_string(year) + " has been compacted");
+    return *segment.program;
+}
+
+const ProgramManager& Ledger::getProgram(DateUnit year) const {
+    const YearSegment& segment = getSegment(year);
+    if(segment.program == nullptr) throw invalid_argument("Year " + std::to_string(year) + " has been compacted");
+    return *segment.program;
+}
+
+bool Ledger::postEntry(const JournalEntry& entry) {
+    DateUnit year = entry.getDate().getYear();
+    YearSegment& segment = getSegment(year);
+    if(segment.closed) throw invalid_argument("Year " + std::to_string(year) + " is closed");
+    const AccountLibrary& accounts = segment.program->getAccountLibrary();
+    //Real accounts carry into later years, which only know accounts that existed at rollover
+    size_t carriedCount = year < getLastYear() ? getSegment(year + 1).program->getAccountLibrary().getAccountCount() : accounts.getAccountCount();
+    for(const JournalModification& line : entry.getModifications()) {
+        const Account* account = line.getAffectedAccount();
+        AccountId id = account->getId();
+        if(id >= accounts.getAccountCount() or &accounts.getAccount(id) != account) throw invalid_argument("Entry line names an account outside the " + std::to_string(year) + " chart");
+        if(isRealAccount(account->getAccountType()) and id >= carriedCount) throw invalid_argument(account->getName() + " was added to " + std::to_string(year) + " after rollover");
+    }
+
+    if(not segment.program->postEntry(entry)) return false;
+    carryForward(year, entry);
+    return true;
+}
+
+void Ledger::carryForward(DateUnit year, const JournalEntry& entry) {
+    if(year == getLastYear()) return;
+    for(const JournalModification& line : entry.getModifications()) {
+        const Account* account = line.getAffectedAccount();
+        if(not isRealAccount(account->getAccountType())) continue;
+        Money delta = line.get().second == account->getBalanceType() ? line.get().first : -line.get().first;
+        for(DateUnit later = year + 1; later <= getLastYear(); ++later) {
+            getProgram(later).shiftBeginningBalance(account->getId(), delta);
+        }
+    }
+}
+
+void Ledger::postClosingEntry(DateUnit year) {
+    ProgramManager& program = getProgram(year);
+    JournalEntry closing = program.getClosingEngine().buildClosingEntry(program.getAccountLibrary().getAccountId("Retained Earnings"));
+    if(closing.getModifications().empty()) return;
+    //Later years would open from balances the closing entry never moved
+    if(not postEntry(closing)) throw invalid_argument("The closing entry for " + std::to_string(year) + " was rejected");
+}
+
+void Ledger::rollover() {
+    DateUnit year = getLastYear();
+    postClosingEntry(year);
+    const AccountLibrary& previous = getProgram(year).getAccountLibrary();
+
+    auto next = std::make_unique<ProgramManager>(year + 1);
+    AccountLibrary& accounts = next->getAccountLibrary();
+    //Accounts are recreated in id order so every AccountId keeps its meaning, as Snapshot::restore does.
+    //Names are then unbound and every live name or alias is rebound to the same account.
+    vector<AccountId> linkedFrom(previous.getAccountCount(), NO_ACCOUNT);
+    for(AccountId id = 0; id < previous.getAccountCount(); ++id) {
+        if(previous.getLinkedId(id) != NO_ACCOUNT) linkedFrom[previous.getLinkedId(id)] = id;
+    }
+    for(AccountId id = 0; id < previous.getAccountCount(); ++id) {
+        const Account& account = previous.getAccount(id);
+        Money beginning = isRealAccount(account.getAccountType()) ? account.getBalance() : Money(0);
+        if(linkedFrom[id] == NO_ACCOUNT) accounts.addAccount(account.getName(), account.getAccountType(), beginning);
+        else accounts.linkAccount(linkedFrom[id], account.getName(), account.getAccountType(), beginning);
+        accounts.removeAlias(account.getName());
+    }
+    for(SymbolId symbol = 0; symbol < previous.getSymbolCount(); ++symbol) {
+        if(previous.resolve(symbol) != NO_ACCOUNT) accounts.addAlias(previous.resolve(symbol), previous.getSymbolName(symbol));
+    }
+
+    years.emplace_back();
+    years.back().program = std::move(next);
+}
+
+void Ledger::closeYear(DateUnit year) {
+    YearSegment& segment = getSegment(year);
+    if(segment.closed) throw invalid_argument("Year " + std::to_string(year) + " is already closed");
+    if(year > firstYear and not getSegment(year - 1).closed) throw invalid_argument("Year " + std::to_string(year - 1) + " must close first");
+    if(year == getLastYear()) throw invalid_argument("Roll year " + std::to_string(year) + " over before closing it");
+
+    postClosingEntry(year);
+    const AccountLibrary& accounts = segment.program->getAccountLibrary();
+    segment.endingBalances.reserve(accounts.getAccountCount());
+    accounts.forEachAccount([&segment](const Account& account) {
+        segment.endingBalances.push_back(account.getBalance());
+    });
+    segment.closed = true;
+}
+
+void Ledger::compactYear(DateUnit year) {
+    YearSegment& segment = getSegment(year);
+    if(not segment.closed) throw invalid_argument("Only a closed year can be compacted");
+    segment.program.reset();
+}
+
+Money Ledger::getEndingBalance(AccountId id, DateUnit year) const {
+    const YearSegment& segment = getSegment(year);
+    if(segment.program == nullptr) return segment.endingBalances.at(id);
+    return segment.program->getAccountLibrary().getAccount(id).getBalance();
+}
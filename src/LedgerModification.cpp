@@ -1,5 +1,5 @@
 #include "../header/LedgerModification.h"
 
 bool LedgerModification::operator==(const LedgerModification& operand) const {
-    return amount == operand.amount and type == operand.type and day == operand.day and description == operand.description;
+    return amount == operand.amount and type == operand.type and day == operand.day and (description == operand.description or *description == *operand.description);
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "../header/LineArena.h"
+
+#include <algorithm>
+
+//Makes sure the last chunk can take count more lines without reallocating
+static vector<JournalModification>& chunkFor(vector<vector<JournalModification>>& chunks, vector<size_t>& liveLines, size_t count) {
+    if(chunks.empty() or chunks.back().capacity() - chunks.back().size() < count) {
+        chunks.emplace_back();
+        chunks.back().reserve(std::max(count, LineArena::CHUNK_LINES));
+        liveLines.push_back(0);
+    }
+    liveLines.back() += count;
+    return chunks.back();
+}
+
+span<JournalModification> LineArena::store(span<JournalModification> lines) {
+    vector<JournalModification>& chunk = chunkFor(chunks, liveLines, lines.size());
+    size_t first = chunk.size();
+    std::move(lines.begin(), lines.end(), std::back_inserter(chunk));
+    lineCount += lines.size();
+    return span<JournalModification>(chunk.data() + first, lines.size());
+}
+
+span<JournalModification> LineArena::store(span<const JournalModification> lines) {
+    vector<JournalModification>& chunk = chunkFor(chunks, liveLines, lines.size());
+    size_t first = chunk.size();
+    chunk.insert(chunk.end(), lines.begin(), lines.end());
+    lineCount += lines.size();
+    return span<JournalModification>(chunk.data() + first, lines.size());
+}
+
+size_t LineArena::getCapacity() const {
+    size_t capacity = 0;
+    for(const vector<JournalModification>& chunk : chunks) capacity += chunk.capacity();
+    return capacity;
+}
+
+void LineArena::release(span<const span<const JournalModification>> runs) {
+    //Chunks ordered by address so each run finds its chunk by binary search
+    vector<size_t> byAddress(chunks.size());
+    for(size_t i = 0; i < byAddress.size(); ++i) byAddress[i] = i;
+    std::less<const JournalModification*> before;
+    std::sort(byAddress.begin(), byAddress.end(), [&](size_t lhs, size_t rhs) { return before(chunks[lhs].data(), chunks[rhs].data()); });
+
+    for(span<const JournalModification> run : runs) {
+        if(run.empty()) continue;
+        auto found = std::upper_bound(byAddress.begin(), byAddress.end(), run.data(), [&](const JournalModification* line, size_t chunk) { return before(line, chunks[chunk].data()); });
+        if(found == byAddress.begin()) continue;
+        size_t chunk = *(found - 1);
+        if(before(run.data(), chunks[chunk].data() + chunks[chunk].size()) and liveLines[chunk] >= run.size()) {
+            liveLines[chunk] -= run.size();
+            lineCount -= run.size();
+        }
+    }
+
+    //Moving a chunk's vector keeps its buffer, so dropping freed chunks from the list moves no stored line
+    size_t kept = 0;
+    for(size_t i = 0; i < chunks.size(); ++i) {
+        if(liveLines[i] == 0 and i + 1 != chunks.size()) continue;
+        if(liveLines[i] == 0) chunks[i].clear();
+        if(kept != i) {
+            chunks[kept] = std::move(chunks[i]);
+            liveLines[kept] = liveLines[i];
+        }
+        ++kept;
+    }
+    chunks.resize(kept);
+    liveLines.resize(kept);
+}
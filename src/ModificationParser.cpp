@@ -0,0 +1,81 @@
+#include "../header/ModificationParser.h"
+
+static bool isBlank(char c) {
+    return c == ' ' or c == '\t' or c == '\r' or c == '\n';
+}
+
+static ModificationParse fail(ModificationParse& result, ModificationError error, size_t column) {
+    result.error = error;
+    result.column = column;
+    return result;
+}
+
+const char* ModificationParse::describe() const {
+    switch(error) {
+        case ModificationError::None: return "No error";
+        case ModificationError::MissingValueType: return "Missing Dr. or Cr.";
+        case ModificationError::UnknownValueType: return "Invalid value type in journal modification";
+        case ModificationError::MissingAccount: return "Missing account name";
+        case ModificationError::MissingSeparator: return "Missing comma between account and amount";
+        case ModificationError::MissingAmount: return "Missing amount";
+        case ModificationError::InvalidAmount: return "Could not read total value change in journal modification";
+        case ModificationError::AmountOutOfRange: return "Amount out of range";
+        case ModificationError::ExcessPrecision: return "Amount has more precision than Money keeps";
+        case ModificationError::TrailingCharacters: return "Unexpected characters after amount";
+        case ModificationError::UnknownAccount: return "No such account or alias";
+    }
+    return "Unknown error";
+}
+
+ModificationParse parseModification(string_view line) {
+    ModificationParse result;
+    const char* begin = line.data();
+    const char* end = begin + line.size();
+    auto columnOf = [begin](const char* at) { return static_cast<size_t>(at - begin); };
+
+    const char* position = begin;
+    while(position != end and isBlank(*position)) ++position;
+    if(position == end) return fail(result, ModificationError::MissingValueType, columnOf(position));
+    switch(*position | 0x20) {
+        case 'd':
+            result.type = ValueType::debit;
+            break;
+        case 'c':
+            result.type = ValueType::credit;
+            break;
+        default:
+            return fail(result, ModificationError::UnknownValueType, columnOf(position));
+    }
+    while(position != end and not isBlank(*position)) ++position;
+    while(position != end and isBlank(*position)) ++position;
+
+    //The account runs to the first comma, the amount is everything after it
+    const char* separator = position;
+    while(separator != end and *separator != ',') ++separator;
+    if(separator == end) return fail(result, position == end ? ModificationError::MissingAccount : ModificationError::MissingSeparator, columnOf(end));
+    const char* accountEnd = separator;
+    while(accountEnd != position and isBlank(accountEnd[-1])) --accountEnd;
+    if(accountEnd == position) return fail(result, ModificationError::MissingAccount, columnOf(position));
+    result.account = string_view(position, accountEnd - position);
+    result.accountColumn = columnOf(position);
+
+    //The amount is everything after the comma, read by the same exact parse as Money::parse
+    position = separator + 1;
+    while(position != end and isBlank(*position)) ++position;
+    if(position == end) return fail(result, ModificationError::MissingAmount, columnOf(position));
+    MoneyParse amount = Money::tryParse(string_view(position, end - position));
+    switch(amount.error) {
+        case MoneyParseError::None:
+            break;
+        case MoneyParseError::InvalidAmount:
+            return fail(result, ModificationError::InvalidAmount, columnOf(position) + amount.column);
+        case MoneyParseError::OutOfRange:
+            return fail(result, ModificationError::AmountOutOfRange, columnOf(position) + amount.column);
+        case MoneyParseError::ExcessPrecision:
+            return fail(result, ModificationError::ExcessPrecision, columnOf(position) + amount.column);
+        case MoneyParseError::TrailingCharacters:
+            return fail(result, ModificationError::TrailingCharacters, columnOf(position) + amount.column);
+    }
+    result.amount = amount.amount;
+    return result;
+}
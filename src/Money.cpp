@@ -0,0 +1,111 @@
+#include "../header/Money.h"
+
+#include <cmath>
+
+#include <limits>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+Money Money::fromDouble(double amount) {
+    return fromMinorUnits(static_cast<int64_t>(std::llround(amount * SCALE)));
+}
+
+static bool isBlank(char c) {
+    return c == ' ' or c == '\t' or c == '\r' or c == '\n' or c == '\v' or c == '\f';
+}
+
+static bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+}
+
+MoneyParse Money::tryParse(string_view amount) {
+    MoneyParse result;
+    auto fail = [&result](MoneyParseError error, size_t column) {
+        result.error = error;
+        result.column = column;
+        return result;
+    };
+
+    size_t pos = 0;
+    while(pos < amount.size() and isBlank(amount[pos])) ++pos;
+    const size_t start = pos;
+
+    bool negative = false;
+    if(pos < amount.size() and (amount[pos] == '-' or amount[pos] == '+')) {
+        negative = amount[pos] == '-';
+        ++pos;
+    }
+    if(pos == amount.size() or (not isDigit(amount[pos]) and amount[pos] != '.')) return fail(MoneyParseError::InvalidAmount, pos);
+
+    const int64_t max = std::numeric_limits<int64_t>::max();
+    int64_t units = 0;
+    //Checked before multiplying so units * 10 + digit can never overflow
+    auto appendDigit = [&units, max](int digit) {
+        if(units > (max - digit) / 10) return false;
+        units = units * 10 + digit;
+        return true;
+    };
+
+    unsigned digitsRead = 0;
+    for(; pos < amount.size() and isDigit(amount[pos]); ++pos, ++digitsRead) {
+        if(not appendDigit(amount[pos] - '0')) return fail(MoneyParseError::OutOfRange, start);
+    }
+
+    unsigned fractionDigits = 0;
+    if(pos < amount.size() and amount[pos] == '.') {
+        ++pos;
+        for(; pos < amount.size() and isDigit(amount[pos]); ++pos, ++digitsRead) {
+            if(fractionDigits < SCALE_DIGITS) {
+                if(not appendDigit(amount[pos] - '0')) return fail(MoneyParseError::OutOfRange, start);
+                ++fractionDigits;
+            } else if(amount[pos] != '0') {
+                return fail(MoneyParseError::ExcessPrecision, pos);
+            }
+        }
+    }
+    if(digitsRead == 0) return fail(MoneyParseError::InvalidAmount, start);
+
+    const size_t trailing = pos;
+    while(pos < amount.size() and isBlank(amount[pos])) ++pos;
+    if(pos != amount.size()) return fail(MoneyParseError::TrailingCharacters, trailing);
+
+    for(; fractionDigits < SCALE_DIGITS; ++fractionDigits) {
+        if(not appendDigit(0)) return fail(MoneyParseError::OutOfRange, start);
+    }
+
+    result.amount = fromMinorUnits(negative ? -units : units);
+    return result;
+}
+
+Money Money::parse(string_view amount) {
+    MoneyParse result = tryParse(amount);
+    switch(result.error) {
+        case MoneyParseError::None: return result.amount;
+        case MoneyParseError::InvalidAmount: throw invalid_argument("No digits in amount");
+        case MoneyParseError::OutOfRange: throw invalid_argument("Amount out of range");
+        case MoneyParseError::ExcessPrecision: throw invalid_argument("Amount has more precision than " + std::to_string(SCALE_DIGITS) + " decimal places");
+        case MoneyParseError::TrailingCharacters: throw invalid_argument("Unexpected characters after amount");
+    }
+    throw invalid_argument("Could not parse amount");
+}
+
+string Money::stringForm() const {
+    //Work with the magnitude as unsigned so INT64_MIN does not overflow
+    uint64_t magnitude = minorUnits < 0 ? 0 - static_cast<uint64_t>(minorUnits) : static_cast<uint64_t>(minorUnits);
+    string output = std::to_string(magnitude / SCALE);
+
+    if(SCALE_DIGITS > 0) {
+        string fraction = std::to_string(magnitude % SCALE);
+        output += '.';
+        output.append(SCALE_DIGITS - fraction.length(), '0');
+        output += fraction;
+    }
+
+    if(minorUnits < 0) output.insert(output.begin(), '-');
+    return output;
+}
+
+ostream& operator<<(ostream& out, const Money& amount) {
+    return out << amount.stringForm();
+}
@@ -3,9 +3,13 @@
 #include <stdexcept>
 using std::invalid_argument;
 
-void MonthRecords::addEntry(JournalModification* entry) {
-    if(entry->getDate().month != month) throw invalid_argument("Invalid month argument");
+void MonthRecords::recordEntry(JournalModification* entry, vector<JournalModification*>& entries) {
+    if(entry->getDate().getMonth() != month) throw invalid_argument("Invalid month argument");
 
     AccountRecords::addEntry(entry);
-    entries.push_back(entry);
-}
\ No newline at end of file
+    insertEntry(entries, entry);
+}
+
+void MonthRecords::addEntry(JournalModification* entry) {
+    recordEntry(entry, getStore());
+}
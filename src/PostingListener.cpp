@@ -0,0 +1,38 @@
+#include "../header/PostingListener.h"
+
+void ChartTotalsListener::countExistingAccounts() {
+    //Accounts already in the chart may carry postings, so they are counted at their current balance
+    accounts->forEachAccount([this](const Account& account) {
+        addToTotals(account, account.getBalance());
+    });
+    accountsCounted = accounts->getAccountCount();
+}
+
+void ChartTotalsListener::countNewAccounts() const {
+    for(; accountsCounted < accounts->getAccountCount(); ++accountsCounted) {
+        const Account& account = accounts->getAccount(AccountId(accountsCounted));
+        addToTotals(account, account.getBeginningBalance());
+    }
+}
+
+void ChartTotalsListener::entryPosted(const JournalEntry& entry) {
+    countNewAccounts();
+    for(const JournalModification& line : entry.getModifications()) {
+        const Account* account = line.getAffectedAccount();
+        if(account->getId() >= accountsCounted) continue; //Not an account of this chart
+        Money amount = line.get().first;
+        addToTotals(*account, line.get().second == account->getBalanceType() ? amount : -amount);
+    }
+}
+
+void ChartTotalsListener::beginningBalanceShifted(const Account& account, Money delta) {
+    //An account not yet counted enters below at its already shifted beginning balance
+    if(account.getId() < accountsCounted) addToTotals(account, delta);
+    countNewAccounts();
+}
+
+void ChartTotalsListener::entriesLoaded(const Account& account, Money change) {
+    //A new account is counted at its beginning balance first, which loading leaves as it was
+    countNewAccounts();
+    if(account.getId() < accountsCounted) addToTotals(account, change);
+}
@@ -5,44 +5,106 @@ using std::invalid_argument;
 
 using std::to_string;
 
-QuarterRecords::QuarterRecords(DateUnit year, DateUnit quarter, ValueType valueType, double beginningBalance) : AccountRecords(year, valueType, beginningBalance), quarter(quarter) {
+QuarterRecords::QuarterRecords(DateUnit year, DateUnit quarter, ValueType valueType, Money beginningBalance) : AccountRecords(year, valueType, beginningBalance), quarter(quarter) {
     if(quarter < 1 or quarter > 4) throw invalid_argument("Accounting quarter not within bounds");
 
+    months.reserve(3);
     for(unsigned i = 1; i <= 3; ++i) {
         months.push_back(MonthRecords(year, i + 3 * (quarter - 1), valueType, beginningBalance));
     }
 }
 
-void QuarterRecords::addEntry(JournalModification* entry) {
-    if(entry->getDate().month < (quarter - 1) * 3 + 1 or entry->getDate().month > quarter * 3) throw invalid_argument("Invalid month for Quarter " + to_string(quarter));
-    for(unsigned i = entry->getDate().month - 3 * (quarter-1); i < 3; ++i) {
-        if(months[i].getEntries().size() != 0) throw invalid_argument("Entry dated " + entry->getDate().stringForm() + " is invalid for quarter " + to_string(quarter));
+QuarterRecords::QuarterRecords(const QuarterRecords& other) : AccountRecords(other), quarter(other.quarter), months(other.months) {
+    //A nested quarter's copy starts its own store at the quarter's first entry, so month ranges move back by the same amount
+    for(unsigned i = 0; i < months.size(); ++i) {
+        months[i].shareParentStore(other.months[i], other.firstEntry - firstEntry);
     }
+    attachChildren();
+}
 
-    AccountRecords::addEntry(entry);/*
-    if(entry->getDate().month - 3 * (quarter-1) - 1 != 0 and months[entry->getDate().month - 3 * (quarter-1) - 1].getEntries().size() == 0) { //Adjust past records
-        if(entry->getDate().month - 3 * (quarter-1) - 2 != 0 and months[entry->getDate().month - 3 * (quarter-1) - 2].getEntries().size() == 0) {
-            months[entry->getDate().month - 3 * (quarter-1) - 2].setBeginningBalance(months[0].getEndingBalance());
-            months[entry->getDate().month - 3 * (quarter-1) - 2].setEndingBalance(months[0].getEndingBalance());
-        }
-        months[entry->getDate().month - 3 * (quarter-1) - 1].setBeginningBalance(months[entry->getDate().month - 3 * (quarter-1) - 2].getEndingBalance());
-        months[entry->getDate().month - 3 * (quarter-1) - 1].setEndingBalance(months[entry->getDate().month - 3 * (quarter-1) - 2].getEndingBalance());
-    }*/
-    months[entry->getDate().month - 3 * (quarter-1) - 1].addEntry(entry);
-    quarterRecords.push_back(entry);
+QuarterRecords& QuarterRecords::operator=(const QuarterRecords& other) {
+    if(this != &other) {
+        QuarterRecords copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
 
-    for(unsigned i = entry->getDate().month - 3 * (quarter-1); i < 3; ++i) { //Prepare future records
-        months[i].setBeginningBalance(months[entry->getDate().month - 3 * (quarter-1) - 1].getEndingBalance());
-        months[i].setEndingBalance(months[entry->getDate().month - 3 * (quarter-1) - 1].getEndingBalance());
+void QuarterRecords::shareParentStore(const AccountRecords& source, uint32_t offset) {
+    AccountRecords::shareParentStore(source, offset);
+    const QuarterRecords& sourceQuarter = static_cast<const QuarterRecords&>(source);
+    for(unsigned i = 0; i < months.size(); ++i) {
+        months[i].shareParentStore(sourceQuarter.months[i], offset);
     }
 }
 
-void QuarterRecords::adjustPeriodBalances(double newValue) {
-    if(quarterRecords.size() != 0) throw invalid_argument("Attempting to change BB and EB of a quarter with existing ledger entries");
+void QuarterRecords::attachChildren() {
+    for(auto& month : months) {
+        month.attachTo(store);
+    }
+}
+
+void QuarterRecords::recordEntry(JournalModification* entry, vector<JournalModification*>& entries) {
+    if(entry->getDate().getQuarter() != quarter) throw invalid_argument("Invalid month for Quarter " + to_string(quarter));
+
+    unsigned month = entry->getDate().getMonthInQuarter();
+    months[month].recordEntry(entry, entries);
+    AccountRecords::addEntry(entry);
+    ++lastEntry;
+
+    for(unsigned i = month + 1; i < 3; ++i) { //Carry the change into later months, entries may arrive in any order
+        months[i].shiftBalances(signedAmount(entry));
+        months[i].shiftEntries(1);
+    }
+}
+
+void QuarterRecords::addEntry(JournalModification* entry) {
+    recordEntry(entry, getStore());
+}
+
+void QuarterRecords::adjustPeriodBalances(Money newValue) {
+    if(lastEntry != firstEntry) throw invalid_argument("Attempting to change BB and EB of a quarter with existing ledger entries");
 
     beginningBalance = endingBalance = newValue;
     for(unsigned i = 0; i < months.size(); ++i) {
         months[i].setBeginningBalance(newValue);
         months[i].setEndingBalance(newValue);
     }
-}
\ No newline at end of file
+}
+
+void QuarterRecords::shiftPeriodBalances(Money delta) {
+    shiftBalances(delta);
+    for(auto& month : months) {
+        month.shiftBalances(delta);
+    }
+}
+
+void QuarterRecords::shiftPeriod(Money delta, uint32_t inserted) {
+    shiftPeriodBalances(delta);
+    shiftEntries(inserted);
+    for(auto& month : months) {
+        month.shiftEntries(inserted);
+    }
+}
+
+void QuarterRecords::absorbBatch(const uint32_t counts[3], const Money deltas[3], uint32_t& insertedBefore, Money& deltaBefore) {
+    firstEntry += insertedBefore;
+    beginningBalance += deltaBefore;
+    for(unsigned i = 0; i < 3; ++i) {
+        months[i].firstEntry += insertedBefore;
+        months[i].beginningBalance += deltaBefore;
+        insertedBefore += counts[i];
+        deltaBefore += deltas[i];
+        months[i].lastEntry += insertedBefore;
+        months[i].endingBalance += deltaBefore;
+    }
+    lastEntry += insertedBefore;
+    endingBalance += deltaBefore;
+}
+
+void QuarterRecords::dropEntries(uint32_t count) {
+    dropFront(count);
+    for(auto& month : months) {
+        month.dropFront(count);
+    }
+}
@@ -0,0 +1,376 @@
+#include "../header/Snapshot.h"
+#include "../header/Checksum.h"
+#include "../header/ProgramManager.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <filesystem>
+
+#include <limits>
+
+#include <stdexcept>
+using std::invalid_argument;
+using std::runtime_error;
+
+#include <unordered_map>
+using std::unordered_map;
+
+#include <vector>
+using std::vector;
+
+static constexpr char MAGIC[4] = {'A', 'S', 'N', 'P'};
+static constexpr size_t COLUMN_ALIGNMENT = 8;
+
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t year;
+    uint32_t accountCount;
+    uint32_t aliasCount;
+    uint32_t entryCount;
+    uint32_t lineCount;
+    uint32_t checksum; //CRC-32 of every byte after the header
+    uint64_t stringBytes;
+};
+
+//Byte offset of every column, derived from the counts alone so the writer and the reader cannot disagree
+struct ColumnOffsets {
+    size_t accountNameOffsets, accountNameLengths, accountLinkedFrom, accountTypes, accountBeginningBalances;
+    size_t aliasOffsets, aliasLengths, aliasTargets;
+    size_t entryLineStarts, entryDates, entryDescriptionOffsets, entryDescriptionLengths;
+    size_t lineDates, lineAccounts, lineDescriptionOffsets, lineAmounts, lineTypes;
+    size_t strings;
+    size_t end;
+};
+
+static ColumnOffsets layOut(const SnapshotHeader& header) {
+    ColumnOffsets at;
+    size_t end = sizeof(SnapshotHeader);
+    auto column = [&end](size_t count, size_t width) {
+        size_t offset = (end + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+        end = offset + count * width;
+        return offset;
+    };
+    at.accountNameOffsets = column(header.accountCount, sizeof(uint32_t));
+    at.accountNameLengths = column(header.accountCount, sizeof(uint32_t));
+    at.accountLinkedFrom = column(header.accountCount, sizeof(uint32_t));
+    at.accountTypes = column(header.accountCount, sizeof(uint8_t));
+    at.accountBeginningBalances = column(header.accountCount, sizeof(int64_t));
+    at.aliasOffsets = column(header.aliasCount, sizeof(uint32_t));
+    at.aliasLengths = column(header.aliasCount, sizeof(uint32_t));
+    at.aliasTargets = column(header.aliasCount, sizeof(uint32_t));
+    at.entryLineStarts = column(size_t(header.entryCount) + 1, sizeof(uint32_t));
+    at.entryDates = column(header.entryCount, sizeof(uint32_t));
+    at.entryDescriptionOffsets = column(header.entryCount, sizeof(uint32_t));
+    at.entryDescriptionLengths = column(header.entryCount, sizeof(uint32_t));
+    at.lineDates = column(header.lineCount, sizeof(uint32_t));
+    at.lineAccounts = column(header.lineCount, sizeof(uint32_t));
+    at.lineDescriptionOffsets = column(header.lineCount, sizeof(uint32_t));
+    at.lineAmounts = column(header.lineCount, sizeof(int64_t));
+    at.lineTypes = column(header.lineCount, sizeof(uint8_t));
+    at.strings = column(header.stringBytes, sizeof(char));
+    at.end = end;
+    return at;
+}
+
+template<typename T>
+static void fill(vector<char>& image, size_t offset, const vector<T>& values) {
+    if(not values.empty()) std::memcpy(image.data() + offset, values.data(), values.size() * sizeof(T));
+}
+
+//Columns start on COLUMN_ALIGNMENT boundaries of a page aligned mapping, so they can be read in place
+template<typename T>
+static span<const T> column(const char* base, size_t offset, size_t count) {
+    return span<const T>(reinterpret_cast<const T*>(base + offset), count);
+}
+
+static void failWith(const string& what) {
+    throw runtime_error(what + ": " + std::strerror(errno));
+}
+
+//Restore indexes per day tables by the date, so only a day of year that Date itself would build gets through
+static bool isDayOf(DateUnit year, const Date& day) {
+    if(day.getYear() != year or day.getMonth() < 1 or day.getMonth() > 12) return false;
+    return day.getDay() >= 1 and day.getDay() <= Date::daysInMonth(year, day.getMonth()) and Date(year, day.getMonth(), day.getDay()) == day;
+}
+
+static uint32_t checkedCount(size_t count) {
+    if(count > std::numeric_limits<uint32_t>::max()) throw invalid_argument("Too large for the snapshot format");
+    return static_cast<uint32_t>(count);
+}
+
+void Snapshot::write(const string& path, const ProgramManager& manager) {
+    const AccountLibrary& accounts = manager.getAccountLibrary();
+    const Journal& journal = manager.getJournal();
+    //Beginning balances plus the journal must rebuild every balance
+    if(journal.getFrozenMonths() != 0) throw invalid_argument("A compacted journal cannot be snapshotted");
+    string pool;
+    auto addString = [&pool](string_view text) {
+        uint32_t offset = checkedCount(pool.size());
+        pool.append(text);
+        checkedCount(pool.size());
+        return offset;
+    };
+
+    vector<uint32_t> accountNameOffsets, accountNameLengths, accountLinkedFrom(accounts.getAccountCount(), NO_ACCOUNT);
+    vector<uint8_t> accountTypes;
+    vector<int64_t> accountBeginningBalances;
+    for(AccountId id = 0; id < accounts.getAccountCount(); ++id) {
+        const Account& account = accounts.getAccount(id);
+        accountNameOffsets.push_back(addString(account.getName()));
+        accountNameLengths.push_back(checkedCount(account.getName().size()));
+        accountTypes.push_back(account.getAccountType());
+        accountBeginningBalances.push_back(account.getBeginningBalance().getMinorUnits());
+        if(accounts.getLinkedId(id) != NO_ACCOUNT) accountLinkedFrom[accounts.getLinkedId(id)] = id;
+    }
+
+    vector<uint32_t> aliasOffsets, aliasLengths, aliasTargets;
+    for(SymbolId symbol = 0; symbol < accounts.getSymbolCount(); ++symbol) {
+        if(accounts.resolve(symbol) == NO_ACCOUNT) continue;
+        const string& alias = accounts.getSymbolName(symbol);
+        aliasOffsets.push_back(addString(alias));
+        aliasLengths.push_back(checkedCount(alias.size()));
+        aliasTargets.push_back(accounts.resolve(symbol));
+    }
+
+    //Each distinct description text is pooled once, however many entries and lines repeat it
+    unordered_map<string_view, uint32_t> pooledDescriptions;
+    auto addDescription = [&](const shared_ptr<const string>& description) {
+        auto found = pooledDescriptions.try_emplace(*description, 0);
+        if(found.second) found.first->second = addString(*description);
+        return found.first->second;
+    };
+    vector<uint32_t> entryLineStarts, entryDates, entryDescriptionOffsets, entryDescriptionLengths;
+    vector<uint32_t> lineDates, lineAccounts, lineDescriptionOffsets;
+    vector<int64_t> lineAmounts;
+    vector<uint8_t> lineTypes;
+    entryLineStarts.reserve(journal.getEntries().size() + 1);
+    lineAmounts.reserve(journal.getLines().size());
+    for(const JournalEntry& entry : journal.getEntries()) {
+        entryLineStarts.push_back(checkedCount(lineAmounts.size()));
+        entryDates.push_back(entry.getDate().getOrdinal());
+        entryDescriptionOffsets.push_back(addDescription(entry.getSharedDescription()));
+        entryDescriptionLengths.push_back(checkedCount(entry.getDescription().size()));
+        for(const JournalModification& line : entry.getModifications()) {
+            if(line.getAffectedAccount()->getId() == NO_ACCOUNT) throw invalid_argument("Cannot snapshot a line for an account outside any library");
+            lineDates.push_back(line.getDate().getOrdinal());
+            lineAccounts.push_back(line.getAffectedAccount()->getId());
+            lineDescriptionOffsets.push_back(addDescription(line.getSharedDescription()));
+            lineAmounts.push_back(line.get().first.getMinorUnits());
+            lineTypes.push_back(line.get().second);
+        }
+    }
+    entryLineStarts.push_back(checkedCount(lineAmounts.size()));
+
+    SnapshotHeader header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.year = journal.getYear();
+    header.accountCount = checkedCount(accountTypes.size());
+    header.aliasCount = checkedCount(aliasTargets.size());
+    header.entryCount = checkedCount(entryDates.size());
+    header.lineCount = checkedCount(lineAmounts.size());
+    header.stringBytes = pool.size();
+
+    ColumnOffsets at = layOut(header);
+    vector<char> image(at.end);
+    fill(image, at.accountNameOffsets, accountNameOffsets);
+    fill(image, at.accountNameLengths, accountNameLengths);
+    fill(image, at.accountLinkedFrom, accountLinkedFrom);
+    fill(image, at.accountTypes, accountTypes);
+    fill(image, at.accountBeginningBalances, accountBeginningBalances);
+    fill(image, at.aliasOffsets, aliasOffsets);
+    fill(image, at.aliasLengths, aliasLengths);
+    fill(image, at.aliasTargets, aliasTargets);
+    fill(image, at.entryLineStarts, entryLineStarts);
+    fill(image, at.entryDates, entryDates);
+    fill(image, at.entryDescriptionOffsets, entryDescriptionOffsets);
+    fill(image, at.entryDescriptionLengths, entryDescriptionLengths);
+    fill(image, at.lineDates, lineDates);
+    fill(image, at.lineAccounts, lineAccounts);
+    fill(image, at.lineDescriptionOffsets, lineDescriptionOffsets);
+    fill(image, at.lineAmounts, lineAmounts);
+    fill(image, at.lineTypes, lineTypes);
+    std::memcpy(image.data() + at.strings, pool.data(), pool.size());
+    header.checksum = crc32(image.data() + sizeof(SnapshotHeader), image.size() - sizeof(SnapshotHeader));
+    std::memcpy(image.data(), &header, sizeof(header));
+
+    //Written beside the target, synced and renamed over it, then the rename is synced,
+    //so a crash leaves either the old snapshot or the complete new one at path
+    string temporary = path + ".tmp";
+    int descriptor = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(descriptor < 0) failWith("Cannot create snapshot " + temporary);
+    const char* data = image.data();
+    size_t remaining = image.size();
+    while(remaining > 0) {
+        ssize_t wrote = ::write(descriptor, data, remaining);
+        if(wrote < 0 and errno == EINTR) continue;
+        if(wrote < 0) {
+            close(descriptor);
+            failWith("Cannot write snapshot " + temporary);
+        }
+        data += wrote;
+        remaining -= wrote;
+    }
+    if(fsync(descriptor) != 0) {
+        close(descriptor);
+        failWith("Cannot sync snapshot " + temporary);
+    }
+    close(descriptor);
+    if(std::rename(temporary.c_str(), path.c_str()) != 0) failWith("Cannot replace snapshot " + path);
+    string directory = std::filesystem::path(path).parent_path().string();
+    descriptor = open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if(descriptor < 0) failWith("Cannot open directory of snapshot " + path);
+    int synced = fsync(descriptor);
+    close(descriptor);
+    if(synced != 0) failWith("Cannot sync directory of snapshot " + path);
+}
+
+Snapshot::Snapshot(const string& path) : mapping(MAP_FAILED), mappedSize(0) {
+    int descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(descriptor < 0) throw runtime_error("Cannot open snapshot " + path + ": " + std::strerror(errno));
+    struct stat status;
+    if(fstat(descriptor, &status) != 0) {
+        close(descriptor);
+        throw runtime_error("Cannot stat snapshot " + path + ": " + std::strerror(errno));
+    }
+    mappedSize = status.st_size;
+    if(mappedSize < sizeof(SnapshotHeader)) {
+        close(descriptor);
+        throw invalid_argument("Not a snapshot: " + path);
+    }
+    mapping = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if(mapping == MAP_FAILED) throw runtime_error("Cannot map snapshot " + path + ": " + std::strerror(errno));
+
+    const char* base = static_cast<const char*>(mapping);
+    SnapshotHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    string problem;
+    if(std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) problem = "Not a snapshot: ";
+    else if(header.version != FORMAT_VERSION) problem = "Unsupported snapshot version " + std::to_string(header.version) + ": ";
+    else if(layOut(header).end != mappedSize) problem = "Truncated snapshot: ";
+    if(not problem.empty()) {
+        munmap(mapping, mappedSize);
+        throw invalid_argument(problem + path);
+    }
+
+    ColumnOffsets at = layOut(header);
+    year = header.year;
+    checksum = header.checksum;
+    strings = base + at.strings;
+    stringBytes = header.stringBytes;
+    accountNameOffsets = column<uint32_t>(base, at.accountNameOffsets, header.accountCount);
+    accountNameLengths = column<uint32_t>(base, at.accountNameLengths, header.accountCount);
+    accountLinkedFrom = column<uint32_t>(base, at.accountLinkedFrom, header.accountCount);
+    accountTypes = column<uint8_t>(base, at.accountTypes, header.accountCount);
+    accountBeginningBalances = column<int64_t>(base, at.accountBeginningBalances, header.accountCount);
+    aliasOffsets = column<uint32_t>(base, at.aliasOffsets, header.aliasCount);
+    aliasLengths = column<uint32_t>(base, at.aliasLengths, header.aliasCount);
+    aliasTargets = column<uint32_t>(base, at.aliasTargets, header.aliasCount);
+    entryLineStarts = column<uint32_t>(base, at.entryLineStarts, size_t(header.entryCount) + 1);
+    entryDates = column<uint32_t>(base, at.entryDates, header.entryCount);
+    entryDescriptionOffsets = column<uint32_t>(base, at.entryDescriptionOffsets, header.entryCount);
+    entryDescriptionLengths = column<uint32_t>(base, at.entryDescriptionLengths, header.entryCount);
+    lineDates = column<uint32_t>(base, at.lineDates, header.lineCount);
+    lineAccounts = column<uint32_t>(base, at.lineAccounts, header.lineCount);
+    lineDescriptionOffsets = column<uint32_t>(base, at.lineDescriptionOffsets, header.lineCount);
+    lineAmounts = column<int64_t>(base, at.lineAmounts, header.lineCount);
+    lineTypes = column<uint8_t>(base, at.lineTypes, header.lineCount);
+}
+
+Snapshot::~Snapshot() {
+    munmap(mapping, mappedSize);
+}
+
+void Snapshot::verify() const {
+    const char* base = static_cast<const char*>(mapping);
+    if(crc32(base + sizeof(SnapshotHeader), mappedSize - sizeof(SnapshotHeader)) != checksum) throw invalid_argument("Corrupt snapshot");
+}
+
+string_view Snapshot::getLineDescription(size_t line) const {
+    //Lines always carry their entry's text, so the entry holding the line gives the length
+    size_t entry = std::upper_bound(entryLineStarts.begin(), entryLineStarts.end(), static_cast<uint32_t>(line)) - entryLineStarts.begin() - 1;
+    return pooled(lineDescriptionOffsets[line], entryDescriptionLengths[entry]);
+}
+
+size_t Snapshot::restore(ProgramManager& manager) const {
+    AccountLibrary& accounts = manager.getAccountLibrary();
+    if(manager.getJournal().getYear() != year) throw invalid_argument("Snapshot is for " + std::to_string(year) + ", not " + std::to_string(manager.getJournal().getYear()));
+    if(accounts.getAccountCount() != 0 or not manager.getJournal().getEntries().empty()) throw invalid_argument("A snapshot restores into an empty program");
+    auto checkString = [this](uint32_t offset, uint32_t length) {
+        if(size_t(offset) + length > stringBytes) throw invalid_argument("Snapshot string out of range");
+    };
+
+    //Accounts are recreated in id order so every AccountId in the line columns keeps its meaning.
+    //Names are then unbound and the alias table rebinds exactly the names that were live.
+    for(AccountId id = 0; id < getAccountCount(); ++id) {
+        checkString(accountNameOffsets[id], accountNameLengths[id]);
+        string name(getAccountName(id));
+        Money beginning = Money::fromMinorUnits(accountBeginningBalances[id]);
+        if(accountLinkedFrom[id] == NO_ACCOUNT) accounts.addAccount(name, getAccountType(id), beginning);
+        else accounts.linkAccount(accountLinkedFrom[id], name, getAccountType(id), beginning);
+        if(accounts.getAccountCount() != size_t(id) + 1) throw invalid_argument("Snapshot account table does not rebuild at " + name);
+        accounts.removeAlias(name);
+    }
+    for(size_t alias = 0; alias < aliasTargets.size(); ++alias) {
+        checkString(aliasOffsets[alias], aliasLengths[alias]);
+        if(aliasTargets[alias] >= getAccountCount()) throw invalid_argument("Snapshot alias names a missing account");
+        accounts.addAlias(aliasTargets[alias], string(pooled(aliasOffsets[alias], aliasLengths[alias])));
+    }
+
+    //Entries go straight into the journal's arena, no entry is validated or posted again
+    Journal& journal = manager.journal;
+    vector<JournalModification*> lineAt(getLineCount()); //Where each line of the columns now lives
+    vector<JournalModification> entryLines;
+    if(entryLineStarts.front() != 0 or entryLineStarts.back() != getLineCount()) throw invalid_argument("Snapshot entries do not cover its lines");
+    //Entries with the same pooled text share one description object, as lines of one entry already do
+    unordered_map<uint32_t, shared_ptr<const string>> descriptions;
+    for(size_t entry = 0; entry < getEntryCount(); ++entry) {
+        checkString(entryDescriptionOffsets[entry], entryDescriptionLengths[entry]);
+        uint32_t first = entryLineStarts[entry], last = entryLineStarts[entry + 1];
+        if(first > last or last > getLineCount()) throw invalid_argument("Snapshot entry lines out of range");
+        Date day = getEntryDate(entry);
+        if(not isDayOf(year, day)) throw invalid_argument("Snapshot entry dated outside its year");
+        shared_ptr<const string>& description = descriptions[entryDescriptionOffsets[entry]];
+        if(not description) description = std::make_shared<const string>(getEntryDescription(entry));
+        entryLines.clear();
+        for(uint32_t line = first; line < last; ++line) {
+            if(lineAccounts[line] >= getAccountCount()) throw invalid_argument("Snapshot line names a missing account");
+            if(lineDates[line] != entryDates[entry]) throw invalid_argument("Snapshot line dated apart from its entry");
+            if(lineTypes[line] > ValueType::credit) throw invalid_argument("Snapshot line is neither a debit nor a credit");
+            entryLines.emplace_back(Money::fromMinorUnits(lineAmounts[line]), ValueType(lineTypes[line]), day, description, &accounts.getAccount(lineAccounts[line]));
+        }
+        span<JournalModification> stored = journal.adopt(day, description, entryLines).getModifications();
+        for(uint32_t line = first; line < last; ++line) lineAt[line] = &stored[line - first];
+    }
+
+    //Lines are put in account order, date order within an account and journal order within a day by two stable counting sorts.
+    //That is the order posting left each account's entries in, so accounts load them without sorting or merging.
+    vector<uint32_t> byDay(getLineCount());
+    vector<size_t> starts(BalanceIndex::DAY_SLOTS + 1);
+    for(size_t line = 0; line < getLineCount(); ++line) ++starts[lineAt[line]->getDate().getDayOfYear() + 1];
+    for(size_t day = 1; day < starts.size(); ++day) starts[day] += starts[day - 1];
+    for(size_t line = 0; line < getLineCount(); ++line) byDay[starts[lineAt[line]->getDate().getDayOfYear()]++] = static_cast<uint32_t>(line);
+    starts.assign(getAccountCount() + 1, 0);
+    for(size_t line = 0; line < getLineCount(); ++line) ++starts[lineAccounts[line] + 1];
+    for(size_t id = 1; id < starts.size(); ++id) starts[id] += starts[id - 1];
+    vector<JournalModification*> sorted(getLineCount());
+    for(uint32_t line : byDay) sorted[starts[lineAccounts[line]]++] = lineAt[line];
+    //Each start was advanced to its account's end, which is where the next account starts
+    size_t begin = 0;
+    for(AccountId id = 0; id < getAccountCount(); ++id) {
+        if(starts[id] != begin) manager.entryPoster.loadEntries(accounts.getAccount(id), span<JournalModification* const>(sorted.data() + begin, starts[id] - begin));
+        begin = starts[id];
+    }
+    return getEntryCount();
+}
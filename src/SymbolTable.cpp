@@ -0,0 +1,27 @@
+#include "../header/SymbolTable.h"
+
+SymbolTable::SymbolTable(const SymbolTable& toCopy) : names(toCopy.names) {
+    //Rebuild the map so its keys view this table's own strings
+    symbols.reserve(names.size());
+    for(SymbolId symbol = 0; symbol < names.size(); ++symbol) symbols.emplace(names[symbol], symbol);
+}
+
+SymbolTable& SymbolTable::operator=(const SymbolTable& toCopy) {
+    if(this != &toCopy) *this = SymbolTable(toCopy);
+    return *this;
+}
+
+SymbolId SymbolTable::intern(string_view name) {
+    auto found = symbols.find(name);
+    if(found != symbols.end()) return found->second;
+
+    SymbolId symbol = static_cast<SymbolId>(names.size());
+    names.emplace_back(name);
+    symbols.emplace(names.back(), symbol);
+    return symbol;
+}
+
+SymbolId SymbolTable::find(string_view name) const {
+    auto found = symbols.find(name);
+    return found == symbols.end() ? NO_SYMBOL : found->second;
+}
@@ -0,0 +1,86 @@
+#include "../header/ThreadPool.h"
+
+using std::lock_guard;
+using std::unique_lock;
+
+ThreadPool::ThreadPool(unsigned threads) : job(nullptr), jobSize(0), nextIndex(0), busyWorkers(0), generation(0), stopping(false) {
+    for(unsigned i = 1; i < threads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(state);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(auto& worker : workers) worker.join();
+}
+
+void ThreadPool::runTasks(const function<void(size_t)>& task, size_t count) {
+    for(size_t i = nextIndex.fetch_add(1, std::memory_order_relaxed); i < count; i = nextIndex.fetch_add(1, std::memory_order_relaxed)) {
+        try {
+            task(i);
+        } catch(...) {
+            lock_guard<mutex> lock(state);
+            if(not failure) failure = std::current_exception();
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    uint64_t seenGeneration = 0;
+    while(true) {
+        const function<void(size_t)>* task;
+        size_t count;
+        {
+            unique_lock<mutex> lock(state);
+            wake.wait(lock, [&] { return stopping or generation != seenGeneration; });
+            if(stopping) return;
+            seenGeneration = generation;
+            //A worker that wakes after the loop already finished finds no job and must not touch the counter,
+            //which may belong to the next loop by the time it would claim an index
+            if(job == nullptr) continue;
+            task = job;
+            count = jobSize;
+            ++busyWorkers;
+        }
+        runTasks(*task, count);
+        {
+            lock_guard<mutex> lock(state);
+            --busyWorkers;
+        }
+        finished.notify_one();
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const function<void(size_t)>& task) {
+    if(count == 0) return;
+    if(workers.empty() or count == 1) {
+        for(size_t i = 0; i < count; ++i) task(i);
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(state);
+        job = &task;
+        jobSize = count;
+        nextIndex.store(0, std::memory_order_relaxed);
+        failure = nullptr;
+        ++generation;
+    }
+    wake.notify_all();
+    runTasks(task, count);
+
+    exception_ptr thrown;
+    {
+        //Every worker that picked up this job must check in before the job goes out of scope
+        unique_lock<mutex> lock(state);
+        finished.wait(lock, [&] { return busyWorkers == 0; });
+        job = nullptr;
+        jobSize = 0;
+        thrown = failure;
+    }
+    if(thrown) std::rethrow_exception(thrown);
+}
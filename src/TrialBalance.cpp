@@ -0,0 +1,73 @@
+#include "../header/TrialBalance.h"
+
+#include <algorithm>
+
+//Balance of account signed so that debits are positive
+static Money signedBalance(const Account& account, Money balance) {
+    return account.getBalanceType() == ValueType::debit ? balance : -balance;
+}
+
+TrialBalance::TrialBalance(AccountLibrary* accounts) : ChartTotalsListener(accounts) {
+    balances.reserve(accounts->getAccountCount());
+    countExistingAccounts();
+    publish();
+}
+
+void TrialBalance::move(AccountType type, Money& balance, Money change) const {
+    Money before = balance;
+    balance += change;
+    Money debitChange = std::max(balance, Money(0)) - std::max(before, Money(0));
+    Money creditChange = std::max(-balance, Money(0)) - std::max(-before, Money(0));
+    typeTotals[type].debits += debitChange;
+    typeTotals[type].credits += creditChange;
+    totals.debits += debitChange;
+    totals.credits += creditChange;
+}
+
+void TrialBalance::addToTotals(const Account& account, Money change) const {
+    if(account.getId() >= balances.size()) balances.resize(size_t(account.getId()) + 1);
+    move(account.getAccountType(), balances[account.getId()], signedBalance(account, change));
+}
+
+void TrialBalance::publish() const {
+    std::lock_guard<mutex> guard(publishedLock);
+    published = totals;
+}
+
+void TrialBalance::entryPosted(const JournalEntry& entry) {
+    ChartTotalsListener::entryPosted(entry);
+    publish();
+}
+
+void TrialBalance::beginningBalanceShifted(const Account& account, Money delta) {
+    ChartTotalsListener::beginningBalanceShifted(account, delta);
+    publish();
+}
+
+void TrialBalance::entriesLoaded(const Account& account, Money change) {
+    ChartTotalsListener::entriesLoaded(account, change);
+    publish();
+}
+
+TrialBalanceTotals TrialBalance::getTotals() const {
+    std::lock_guard<mutex> guard(publishedLock);
+    return published;
+}
+
+TrialBalanceTotals TrialBalance::getTypeTotals(AccountType type) const {
+    countNewAccounts();
+    publish();
+    return typeTotals.at(type);
+}
+
+Money TrialBalance::getDebitBalance(AccountId id) const {
+    countNewAccounts();
+    publish();
+    return std::max(balances.at(id), Money(0));
+}
+
+Money TrialBalance::getCreditBalance(AccountId id) const {
+    countNewAccounts();
+    publish();
+    return std::max(-balances.at(id), Money(0));
+}
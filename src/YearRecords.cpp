@@ -1,28 +1,130 @@
 #include "../header/YearRecords.h"
 #include "../header/JournalModification.h"
 
+#include <algorithm>
+
 #include <stdexcept>
 using std::invalid_argument;
 
 using std::to_string;
 
-YearRecords::YearRecords(DateUnit year, ValueType valueType, double beginningBalance) : AccountRecords(year, valueType, beginningBalance) {
+YearRecords::YearRecords(DateUnit year, ValueType valueType, Money beginningBalance) : AccountRecords(year, valueType, beginningBalance) {
+    quarters.reserve(4);
     for(unsigned i = 1; i <= 4; ++i) {
         quarters.push_back(QuarterRecords(year, i, valueType, beginningBalance));
     }
 }
 
-void YearRecords::addEntry(JournalModification* entry) {
-    if(entry->getDate().year != year) throw invalid_argument("Incompatible year");
-    for(unsigned i = (entry->getDate().month-1) / 3 + 1; i < 4; ++i) {
-        if(quarters[i].getEntries().size() != 0) throw invalid_argument("Entry dated " + entry->getDate().stringForm() + " is invalid for year " + to_string(year));
+YearRecords::YearRecords(const YearRecords& other) : AccountRecords(other), quarters(other.quarters) {
+    //The year is outermost, so its copy keeps the same positions and its quarters share the copied store
+    for(unsigned i = 0; i < quarters.size(); ++i) {
+        quarters[i].shareParentStore(other.quarters[i], 0);
+    }
+    attachChildren();
+}
+
+YearRecords& YearRecords::operator=(const YearRecords& other) {
+    if(this != &other) {
+        YearRecords copy(other);
+        *this = std::move(copy);
     }
+    return *this;
+}
+
+void YearRecords::attachChildren() {
+    for(auto& quarter : quarters) {
+        quarter.attachTo(store);
+        quarter.attachChildren();
+    }
+}
 
-    quarters[(entry->getDate().month-1) / 3].addEntry(entry);
+void YearRecords::addEntry(JournalModification* entry) {
+    if(entry->getDate().getYear() != year) throw invalid_argument("Incompatible year");
+
+    unsigned quarter = entry->getDate().getQuarterIndex();
+    quarters[quarter].recordEntry(entry, getStore());
     AccountRecords::addEntry(entry);
-    entries.push_back(entry);
+    ++lastEntry;
+
+    for(unsigned i = quarter + 1; i < 4; ++i) { //Carry the change into later quarters, entries may arrive in any order
+        quarters[i].shiftPeriod(signedAmount(entry), 1);
+    }
+}
+
+void YearRecords::addEntries(span<JournalModification* const> entries) {
+    for(const auto entry : entries) {
+        if(entry->getDate().getYear() != year) throw invalid_argument("Incompatible year");
+    }
+    if(entries.empty()) return;
 
-    for(unsigned i = (entry->getDate().month-1) / 3 + 1; i < 4; ++i) { //Prepare future records
-        quarters[i].adjustPeriodBalances(quarters[(entry->getDate().month-1) / 3].getEndingBalance());
+    uint32_t counts[12] = {};
+    Money deltas[12];
+    for(const auto entry : entries) {
+        ++counts[entry->getDate().getMonthIndex()];
+        deltas[entry->getDate().getMonthIndex()] += signedAmount(entry);
     }
-}
\ No newline at end of file
+
+    //Stable sort and merge keep same-day entries in arrival order, after the ones already stored, exactly as addEntry would
+    auto byDate = [](const JournalModification* lhs, const JournalModification* rhs) { return lhs->getDate() < rhs->getDate(); };
+    vector<JournalModification*>& stored = getStore();
+    size_t previousSize = stored.size();
+    stored.insert(stored.end(), entries.begin(), entries.end());
+    std::stable_sort(stored.begin() + previousSize, stored.end(), byDate);
+    if(previousSize != 0 and byDate(stored[previousSize], stored[previousSize - 1])) {
+        std::inplace_merge(stored.begin(), stored.begin() + previousSize, stored.end(), byDate);
+    }
+
+    uint32_t insertedBefore = 0;
+    Money deltaBefore;
+    for(unsigned quarter = 0; quarter < 4; ++quarter) {
+        quarters[quarter].absorbBatch(counts + 3 * quarter, deltas + 3 * quarter, insertedBefore, deltaBefore);
+    }
+    lastEntry += insertedBefore;
+    endingBalance += deltaBefore;
+}
+
+void YearRecords::loadEntries(span<JournalModification* const> entries) {
+    if(not getEntries().empty()) throw invalid_argument("Entries can only be loaded into records that hold none");
+    if(entries.empty()) return;
+    auto byDate = [](const JournalModification* lhs, const JournalModification* rhs) { return lhs->getDate() < rhs->getDate(); };
+    if(not std::is_sorted(entries.begin(), entries.end(), byDate)) throw invalid_argument("Entries to load are not in date order");
+    if(entries.front()->getDate().getYear() != year or entries.back()->getDate().getYear() != year) throw invalid_argument("Incompatible year");
+
+    uint32_t counts[12] = {};
+    Money deltas[12];
+    for(const auto entry : entries) {
+        ++counts[entry->getDate().getMonthIndex()];
+        deltas[entry->getDate().getMonthIndex()] += signedAmount(entry);
+    }
+    getStore().assign(entries.begin(), entries.end());
+
+    uint32_t insertedBefore = 0;
+    Money deltaBefore;
+    for(unsigned quarter = 0; quarter < 4; ++quarter) {
+        quarters[quarter].absorbBatch(counts + 3 * quarter, deltas + 3 * quarter, insertedBefore, deltaBefore);
+    }
+    lastEntry += insertedBefore;
+    endingBalance += deltaBefore;
+}
+
+void YearRecords::shiftYearBalances(Money delta) {
+    shiftBalances(delta);
+    for(auto& quarter : quarters) {
+        quarter.shiftPeriodBalances(delta);
+    }
+}
+
+void YearRecords::dropEntriesThrough(DateUnit month) {
+    if(month < 1 or month > 12) throw invalid_argument("Incompatible month");
+    //The store is date ordered, so the months being dropped are its front
+    uint32_t count = 0;
+    for(DateUnit i = 1; i <= month; ++i) count += getMonthRecords(i).getEntries().size();
+    if(count == 0) return;
+    vector<JournalModification*>& stored = getStore();
+    stored.erase(stored.begin(), stored.begin() + count);
+    stored.shrink_to_fit();
+    dropFront(count);
+    for(auto& quarter : quarters) {
+        quarter.dropEntries(count);
+    }
+}
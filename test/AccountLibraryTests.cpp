@@ -5,10 +5,14 @@ using ::testing::_;
 using ::testing::InSequence;
 
 #include "../header/AccountLibrary.h"
+#include "AllocationCounter.h"
 
 #include <string>
 using std::string;
 
+#include <vector>
+using std::vector;
+
 #include <stdexcept>
 using std::invalid_argument;
 
@@ -125,4 +129,139 @@ TEST(AccountLibraryTests, testRemoveAlias) {
     }, invalid_argument);
 
     EXPECT_EQ(accounts.getAccount("Cash"), accounts.getAccount("Cash"));
-}
\ No newline at end of file
+}
+TEST(AccountLibraryTests, testForEachAccount) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Sales", AccountType::Revenue, 100);
+    accounts.addAccount("Service Revenue", AccountType::Revenue, 50);
+    accounts.addAccount("Rent Expense", AccountType::Expense, 30);
+
+    const AccountLibrary& constAccounts = accounts;
+    vector<const Account*> visited;
+    constAccounts.forEachAccount(AccountType::Revenue, [&visited](const Account& account) {
+        visited.push_back(&account);
+    });
+
+    ASSERT_EQ(visited.size(), 2);
+    EXPECT_EQ(visited[0], &accounts.getAccount("Sales"));
+    EXPECT_EQ(visited[1], &accounts.getAccount("Service Revenue"));
+
+    //Getters hand back the library's own lists rather than copies
+    EXPECT_EQ(&constAccounts.getRevenues().front(), visited[0]);
+
+    visited.clear();
+    constAccounts.forEachAccount(AccountType::LOSS, [&visited](const Account& account) {
+        visited.push_back(&account);
+    });
+    EXPECT_TRUE(visited.empty());
+}
+
+TEST(AccountLibraryTests, testAccountIds) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", AccountType::Asset, 1000);
+    accounts.addAccount("Sales", AccountType::Revenue);
+    accounts.addAccount("Equipment", AccountType::Asset, 500);
+    accounts.linkAccount("Equipment", "Accumulated Depreciation", AccountType::ContraAsset, 100);
+    accounts.addAlias("Cash", "Checking");
+
+    EXPECT_EQ(accounts.getAccountCount(), 4);
+    EXPECT_EQ(accounts.getAccountId("Cash"), 0);
+    EXPECT_EQ(accounts.getAccountId("checking"), 0);
+    EXPECT_EQ(accounts.getAccountId("Equipment"), 2);
+    EXPECT_EQ(&accounts.getAccount(accounts.getAccountId("Sales")), &accounts.getAccount("Sales"));
+    //Accounts know their own id, accounts outside a library have none
+    EXPECT_EQ(accounts.getAccount("Accumulated Depreciation").getId(), 3);
+    EXPECT_EQ(accounts.getAccount("Sales").getId(), 1);
+    EXPECT_EQ(AssetAccount("Loose", 2024, 0).getId(), NO_ACCOUNT);
+    EXPECT_THROW({
+        accounts.getAccountId("Land");
+    }, invalid_argument);
+
+    EXPECT_EQ(accounts.getLinkedId(accounts.getAccountId("Cash")), NO_ACCOUNT);
+    EXPECT_EQ(accounts.getLinkedId(accounts.getAccountId("Equipment")), accounts.getAccountId("Accumulated Depreciation"));
+    EXPECT_EQ(accounts.findLinked("Equipment"), &accounts.getAccount("Accumulated Depreciation"));
+
+    //Per-type lists hold ids in insertion order, and linked contra accounts are listed under their own type
+    EXPECT_EQ(accounts.getAssets().getIds(), vector<AccountId>({0, 2}));
+    EXPECT_EQ(accounts.getAccounts(AccountType::ContraAsset).size(), 1);
+    EXPECT_EQ(accounts.getAccounts(AccountType::ContraAsset).front().getName(), "Accumulated Depreciation");
+
+    //References handed out earlier survive the table growing
+    const Account* cash = &accounts.getAccount("Cash");
+    for(int i = 0; i < 1000; ++i) accounts.addAccount("Expense " + std::to_string(i), AccountType::Expense);
+    EXPECT_EQ(cash, &accounts.getAccount("Cash"));
+    EXPECT_EQ(accounts.getExpenses().size(), 1000);
+
+    size_t visited = 0;
+    accounts.forEachAccount([&visited](const Account&) { ++visited; });
+    EXPECT_EQ(visited, accounts.getAccountCount());
+}
+
+TEST(AccountLibraryTests, testContraEquity) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Treasury Stock", AccountType::ContraEquity, 200);
+    accounts.addAccount("Common Stock", AccountType::StockholdersEquity, 1000);
+    accounts.linkAccount("Common Stock", "Stock Subscriptions Receivable", AccountType::ContraEquity, 50);
+
+    //getContraEquity keeps to standalone contra equity accounts, the per-type list holds both
+    EXPECT_EQ(accounts.getContraEquity().size(), 1);
+    EXPECT_EQ(accounts.getContraEquity().front().getName(), "Treasury Stock");
+    EXPECT_EQ(accounts.getAccounts(AccountType::ContraEquity).size(), 2);
+}
+
+TEST(AccountLibraryTests, testLookupIgnoresCaseWithoutAllocating) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Accounts Receivable", AccountType::Asset, 1000);
+    accounts.addAlias("Accounts Receivable", "AR");
+    string mixedCase = "aCcOuNtS rEcEiVaBlE";
+
+    size_t allocationsBefore = AllocationCounter::getAllocations();
+    const Account& byName = accounts.getAccount(mixedCase);
+    AccountId byAlias = accounts.getAccountId("ar");
+    EXPECT_EQ(AllocationCounter::getAllocations() - allocationsBefore, 0);
+
+    EXPECT_EQ(byName.getName(), "Accounts Receivable");
+    EXPECT_EQ(&accounts.getAccount(byAlias), &byName);
+
+    EXPECT_FALSE(accounts.addAlias("Accounts Receivable", "ACCOUNTS RECEIVABLE"));
+    accounts.removeAlias("Ar");
+    EXPECT_THROW({
+        accounts.getAccount("AR");
+    }, invalid_argument);
+}
+
+TEST(AccountLibraryTests, testSymbols) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", AccountType::Asset, 1000);
+    accounts.addAccount("Land", AccountType::Asset, 500);
+    accounts.addAlias("Cash", "Checking");
+
+    SymbolId checking = accounts.findSymbol("CHECKING");
+    ASSERT_NE(checking, NO_SYMBOL);
+    EXPECT_EQ(accounts.getSymbolName(checking), "Checking");
+    EXPECT_EQ(accounts.resolve(checking), accounts.getAccountId("Cash"));
+    EXPECT_EQ(accounts.findSymbol("Equipment"), NO_SYMBOL);
+    EXPECT_EQ(accounts.resolve(NO_SYMBOL), NO_ACCOUNT);
+
+    //Removing an alias keeps its symbol but unbinds it, re-adding it binds the same symbol again
+    accounts.removeAlias("checking");
+    EXPECT_EQ(accounts.resolve(checking), NO_ACCOUNT);
+    EXPECT_TRUE(accounts.addAlias("Land", "Checking"));
+    EXPECT_EQ(accounts.findSymbol("Checking"), checking);
+    EXPECT_EQ(accounts.resolve(checking), accounts.getAccountId("Land"));
+}
+
+TEST(AccountLibraryTests, testLinkAndAliasById) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Equipment", AccountType::Asset, 500);
+    accounts.linkAccount(AccountId(0), "Accumulated Depreciation", AccountType::ContraAsset, 100);
+
+    EXPECT_EQ(accounts.getLinkedId(0), 1);
+    EXPECT_TRUE(accounts.addAlias(AccountId(1), "ADE"));
+    EXPECT_EQ(accounts.getAccountId("ade"), 1);
+    EXPECT_FALSE(accounts.addAlias(AccountId(0), "ADE"));
+    EXPECT_EQ(accounts.getSymbolCount(), 3);
+
+    EXPECT_THROW(accounts.addAlias(AccountId(7), "Nothing"), invalid_argument);
+    EXPECT_THROW(accounts.linkAccount(AccountId(7), "Nothing", AccountType::ContraAsset), invalid_argument);
+}
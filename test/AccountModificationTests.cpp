@@ -11,7 +11,7 @@ using std::string;
 
 class AccountModificationTestDriver : public AccountModification {
     public:
-        AccountModificationTestDriver(double amount, ValueType type, const Date &day, const string& description) : AccountModification(amount, type, day, description) {}
+        AccountModificationTestDriver(Money amount, ValueType type, const Date &day, const string& description) : AccountModification(amount, type, day, description) {}
 };
 
 TEST(AccountModificationTests, testCashToSupplies) {
@@ -16,12 +16,8 @@ using std::vector;
 using std::invalid_argument;
 
 class AccountRecordsTestDriver : public AccountRecords {
-    private:
-        vector<JournalModification*> modifications;
     public:
-        AccountRecordsTestDriver(DateUnit year, ValueType vt, double amt) : AccountRecords(year, vt, amt) {}
-
-        const vector<JournalModification*>& getEntries() const { return modifications; }
+        AccountRecordsTestDriver(DateUnit year, ValueType vt, Money amt) : AccountRecords(year, vt, amt) {}
 };
 
 TEST(AccountRecordsTests, testConstructor) {
@@ -14,7 +14,7 @@ using std::invalid_argument;
 
 class AccountTestsDriver : public Account {
     public:
-        AccountTestsDriver(const string& name, ValueType valueType, AccountType accountType, DateUnit year, double beginningBalance = 0) : Account(name, valueType, accountType, year, beginningBalance) {}
+        AccountTestsDriver(const string& name, ValueType valueType, AccountType accountType, DateUnit year, Money beginningBalance = 0) : Account(name, valueType, accountType, year, beginningBalance) {}
         const MonthRecords& getMonthRecords(DateUnit month) const { return records.getQuarterRecords()[(month-1) / 3].getMonthRecords()[(month-1) % 3]; }
 };
 
@@ -158,4 +158,30 @@ TEST(AccountTests, testThrow) {
         JournalModification test(100, ValueType::debit, Date("01/01/2000"), "", &account);
         account.addEntry(&test);
     }, invalid_argument);
-}
\ No newline at end of file
+}
+
+TEST(AccountTests, testBalanceAsOf) {
+    AccountTestsDriver cash("Cash", ValueType::debit, AccountType::Asset, 2024, 1000); //Start 2024 with $1000 Cash
+
+    JournalModification modification1(100, ValueType::debit, Date("03/17/2024"), "Earn $100", &cash);
+    JournalModification modification2(30, ValueType::credit, Date("01/05/2024"), "Pay $30", &cash);
+    JournalModification modification3(500, ValueType::debit, Date("12/31/2024"), "Earn $500", &cash);
+    cash.addEntry(&modification1);
+    cash.addEntry(&modification2);
+    cash.addEntry(&modification3);
+
+    EXPECT_EQ(cash.getBalanceBefore(Date("01/01/2024")), 1000);
+    EXPECT_EQ(cash.getBalanceAsOf(Date("01/04/2024")), 1000);
+    EXPECT_EQ(cash.getBalanceAsOf(Date("01/05/2024")), 970);
+    EXPECT_EQ(cash.getBalanceBefore(Date("03/17/2024")), 970);
+    EXPECT_EQ(cash.getBalanceAsOf(Date("03/17/2024")), 1070);
+    EXPECT_EQ(cash.getBalanceAsOf(Date("12/30/2024")), 1070);
+    EXPECT_EQ(cash.getBalanceAsOf(Date("12/31/2024")), cash.getBalance());
+
+    EXPECT_EQ(cash.getNetChange(Date("01/01/2024"), Date("03/31/2024")), 70);
+    EXPECT_EQ(cash.getNetChange(Date("03/18/2024"), Date("12/30/2024")), 0);
+
+    EXPECT_THROW({
+        cash.getBalanceAsOf(Date("01/01/2025"));
+    }, invalid_argument);
+}
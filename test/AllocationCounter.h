@@ -0,0 +1,12 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+//Counts calls to the global operator new, linking AllocationCounter.cpp replaces the default allocation functions
+class AllocationCounter {
+    public:
+        static size_t getAllocations();
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/BalanceIndex.h"
+
+#include <stdexcept>
+using std::out_of_range;
+
+#include <vector>
+using std::vector;
+
+TEST(BalanceIndexTests, testEmpty) {
+    BalanceIndex index;
+
+    EXPECT_TRUE(index.empty());
+    EXPECT_EQ(index.prefixSum(0), 0);
+    EXPECT_EQ(index.prefixSum(365), 0);
+    EXPECT_EQ(index.rangeSum(10, 20), 0);
+}
+
+TEST(BalanceIndexTests, testPrefixAndRangeSums) {
+    BalanceIndex index;
+    index.add(0, 100);
+    index.add(31, -40);
+    index.add(31, 10);
+    index.add(365, 5);
+
+    EXPECT_FALSE(index.empty());
+    EXPECT_EQ(index.prefixSum(0), 100);
+    EXPECT_EQ(index.prefixSum(30), 100);
+    EXPECT_EQ(index.prefixSum(31), 70);
+    EXPECT_EQ(index.prefixSum(364), 70);
+    EXPECT_EQ(index.prefixSum(365), 75);
+    EXPECT_EQ(index.rangeSum(1, 31), -30);
+    EXPECT_EQ(index.rangeSum(32, 364), 0);
+    EXPECT_EQ(index.rangeSum(31, 0), 0);
+
+    EXPECT_THROW(index.add(366, 1), out_of_range);
+}
+
+TEST(BalanceIndexTests, testMatchesNaiveSums) {
+    BalanceIndex index;
+    Money naive[BalanceIndex::DAY_SLOTS];
+    for(unsigned i = 0; i < 1000; ++i) {
+        unsigned day = (i * 7919) % BalanceIndex::DAY_SLOTS;
+        Money delta = Money::fromMinorUnits(static_cast<int64_t>(i % 13) - 6);
+        index.add(day, delta);
+        naive[day] += delta;
+    }
+
+    Money runningTotal;
+    for(unsigned day = 0; day < BalanceIndex::DAY_SLOTS; ++day) {
+        runningTotal += naive[day];
+        ASSERT_EQ(index.prefixSum(day), runningTotal);
+    }
+}
+
+TEST(BalanceIndexTests, testAssignMatchesAdd) {
+    BalanceIndex added, assigned;
+    Money changes[BalanceIndex::DAY_SLOTS];
+    for(unsigned day = 0; day < BalanceIndex::DAY_SLOTS; day += 3) {
+        changes[day] = Money::fromMinorUnits(static_cast<int64_t>(day % 17) - 8);
+        added.add(day, changes[day]);
+    }
+    assigned.assign(changes);
+    for(unsigned day = 0; day < BalanceIndex::DAY_SLOTS; ++day) {
+        ASSERT_EQ(assigned.prefixSum(day), added.prefixSum(day));
+    }
+    vector<Money> tooMany(BalanceIndex::DAY_SLOTS + 1);
+    EXPECT_THROW(assigned.assign(tooMany), out_of_range);
+}
@@ -0,0 +1,72 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/CaseInsensitiveHash.h"
+
+#include <cstdint>
+
+#include <string>
+using std::string;
+
+#include <unordered_map>
+using std::unordered_map;
+
+TEST(CaseInsensitiveHashTests, testEqualIgnoresCase) {
+    CaseInsensitiveEqual equal;
+
+    EXPECT_TRUE(equal("Accounts Receivable", "ACCOUNTS RECEIVABLE"));
+    EXPECT_TRUE(equal("cash", "Cash"));
+    EXPECT_TRUE(equal("", ""));
+    EXPECT_FALSE(equal("Cash", "Cash "));
+    EXPECT_FALSE(equal("Cash", "Cask"));
+}
+
+TEST(CaseInsensitiveHashTests, testHashIgnoresCase) {
+    CaseInsensitiveHash hash;
+
+    EXPECT_EQ(hash("Retained Earnings"), hash("RETAINED earnings"));
+    EXPECT_EQ(hash("ar"), hash("AR"));
+    EXPECT_NE(hash("Cash"), hash("Land"));
+}
+
+TEST(CaseInsensitiveHashTests, testHeterogeneousLookup) {
+    unordered_map<string, int, CaseInsensitiveHash, CaseInsensitiveEqual> names;
+    names.emplace("Cash", 1);
+    names.emplace("Accounts Payable", 2);
+
+    string_view probe = "accounts payable";
+    ASSERT_NE(names.find(probe), names.end());
+    EXPECT_EQ(names.find(probe)->second, 2);
+    EXPECT_EQ(names.find(probe)->first, "Accounts Payable");
+    EXPECT_EQ(names.find(string_view("Land")), names.end());
+}
+
+TEST(CaseInsensitiveHashTests, testWordUpperMatchesByteUpper) {
+    for(unsigned value = 0; value < 256; ++value) {
+        for(unsigned byte = 0; byte < 8; ++byte) {
+            uint64_t word = 0x4061627A5B7B7E80ull ^ (static_cast<uint64_t>(value) << (byte * 8));
+            uint64_t expected = 0;
+            for(unsigned i = 0; i < 8; ++i) {
+                expected |= static_cast<uint64_t>(static_cast<unsigned char>(asciiUpper(static_cast<char>(word >> (i * 8))))) << (i * 8);
+            }
+            ASSERT_EQ(asciiUpperWord(word), expected) << "byte value " << value << " at " << byte;
+        }
+    }
+}
+
+TEST(CaseInsensitiveHashTests, testLongAndShortNames) {
+    CaseInsensitiveHash hash;
+    CaseInsensitiveEqual equal;
+
+    //Cover names shorter than, equal to, and longer than one eight byte word
+    EXPECT_TRUE(equal("Land", "LAND"));
+    EXPECT_TRUE(equal("Supplies", "sUPPLIES"));
+    EXPECT_TRUE(equal("Accumulated Depreciation - Equipment", "ACCUMULATED DEPRECIATION - EQUIPMENT"));
+    EXPECT_FALSE(equal("Accumulated Depreciation - Equipment", "Accumulated Depreciation - Equipmenu"));
+    EXPECT_FALSE(equal("Wages Payable[", "Wages Payable{"));
+    EXPECT_EQ(hash("Accumulated Depreciation - Equipment"), hash("accumulated depreciation - equipment"));
+    EXPECT_NE(hash("Land"), hash("Lan"));
+}
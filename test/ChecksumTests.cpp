@@ -0,0 +1,21 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/Checksum.h"
+
+TEST(ChecksumTests, testKnownValue) {
+    //Standard CRC-32 check value
+    EXPECT_EQ(crc32("123456789", 9), 0xCBF43926u);
+    EXPECT_EQ(crc32("", 0), 0u);
+    EXPECT_EQ(crc32("56789", 5, crc32("1234", 4)), 0xCBF43926u);
+}
+
+TEST(ChecksumTests, testDetectsChange) {
+    char record[] = "Sale 12 01/02/2024";
+    uint32_t original = crc32(record, sizeof(record));
+    record[5] = '3';
+    EXPECT_NE(crc32(record, sizeof(record)), original);
+}
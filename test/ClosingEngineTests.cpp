@@ -0,0 +1,118 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/ClosingEngine.h"
+#include "../header/ProgramManager.h"
+#include "TestEntries.h"
+
+#include <filesystem>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+TEST(ClosingEngineTests, testRunningTotals) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    const ClosingEngine& closing = program.getClosingEngine();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.linkAccount("Sales Revenue", "Sales Returns", ContraRevenue, 0);
+    accounts.addAccount("Wages Expense", Expense, 0);
+    accounts.addAccount("Gain on Sale", GAIN, 0);
+    accounts.addAccount("Loss on Disposal", LOSS, 0);
+
+    EXPECT_EQ(closing.getTypeBalance(Asset), 1000);
+    EXPECT_EQ(closing.getNetIncome(), 0);
+
+    post(program, Date(2024, 3, 1), 500, "Cash", "Sales Revenue");
+    post(program, Date(2024, 3, 2), 50, "Sales Returns", "Cash");
+    post(program, Date(2024, 3, 3), 200, "Wages Expense", "Cash");
+    post(program, Date(2024, 3, 4), 30, "Cash", "Gain on Sale");
+    post(program, Date(2024, 3, 5), 10, "Loss on Disposal", "Cash");
+
+    EXPECT_EQ(closing.getTypeBalance(Asset), 1270);
+    EXPECT_EQ(closing.getTypeBalance(Revenue), 500);
+    EXPECT_EQ(closing.getTypeBalance(ContraRevenue), 50);
+    EXPECT_EQ(closing.getNetIncome(), 500 - 50 - 200 + 30 - 10);
+
+    //Totals track postings made before the engine existed as well as accounts added afterwards
+    ClosingEngine late(&accounts);
+    EXPECT_EQ(late.getNetIncome(), closing.getNetIncome());
+    accounts.addAccount("Consulting Revenue", Revenue, 25);
+    EXPECT_EQ(late.getTypeBalance(Revenue), 525);
+    EXPECT_EQ(closing.getTypeBalance(Revenue), 525);
+}
+
+TEST(ClosingEngineTests, testClosingEntry) {
+    ProgramManager program(2025);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Retained Earnings", StockholdersEquity, 0);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.addAccount("Idle Revenue", Revenue, 0);
+    accounts.addAccount("Wages Expense", Expense, 0);
+    accounts.addAccount("Gain on Sale", GAIN, 0);
+    accounts.addAccount("Loss on Disposal", LOSS, 0);
+    accounts.addAccount("Dividends", Dividends, 0);
+
+    post(program, Date(2025, 3, 1), 500, "Cash", "Sales Revenue");
+    post(program, Date(2025, 3, 2), 200, "Wages Expense", "Cash");
+    post(program, Date(2025, 3, 3), 30, "Cash", "Gain on Sale");
+    post(program, Date(2025, 3, 4), 10, "Loss on Disposal", "Cash");
+    post(program, Date(2025, 3, 5), 100, "Dividends", "Cash");
+
+    program.postClosingEntry();
+    const JournalEntry& cje = program.getJournal().getEntries().back();
+    EXPECT_EQ(cje.getDate(), Date(2025, 12, 31));
+    EXPECT_TRUE(cje.validate());
+    //Idle Revenue has nothing to close, so it gets no line
+    EXPECT_EQ(cje.getModifications().size(), 6);
+
+    for(const char* name : {"Sales Revenue", "Idle Revenue", "Wages Expense", "Gain on Sale", "Loss on Disposal", "Dividends"}) {
+        EXPECT_EQ(accounts.getAccount(name).getBalance(), 0) << name;
+    }
+    EXPECT_EQ(accounts.getAccount("Retained Earnings").getBalance(), 500 - 200 + 30 - 10 - 100);
+    EXPECT_EQ(program.getClosingEngine().getNetIncome(), 0);
+}
+
+TEST(ClosingEngineTests, testNetLossDebitsRetainedEarnings) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Retained Earnings", StockholdersEquity, 500);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.addAccount("Rent Expense", Expense, 0);
+
+    post(program, Date(2024, 6, 1), 100, "Cash", "Sales Revenue");
+    post(program, Date(2024, 6, 1), 300, "Rent Expense", "Cash");
+
+    program.postClosingEntry();
+    const JournalEntry& cje = program.getJournal().getEntries().back();
+    ASSERT_EQ(cje.getModifications().size(), 3);
+    //Debits come first, the net loss lands on the debit side after the revenue
+    EXPECT_EQ(cje.getModifications()[1].getAffectedAccount(), &accounts.getAccount("Retained Earnings"));
+    EXPECT_EQ(cje.getModifications()[1].get().second, ValueType::debit);
+    EXPECT_EQ(accounts.getAccount("Retained Earnings").getBalance(), 300);
+}
+
+TEST(ClosingEngineTests, testRejectedClosingEntryThrows) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Retained Earnings", StockholdersEquity, 0);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    post(program, Date(2024, 6, 1), 100, "Cash", "Sales Revenue");
+
+    //Once December is compacted the journal refuses the 12/31 entry, which must not pass silently
+    string directory = ::testing::TempDir() + "ClosingEngineTests_rejected";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    ColdStore cold(&accounts, directory);
+    program.setColdStore(&cold);
+    program.compactThrough(12);
+    EXPECT_THROW(program.postClosingEntry(), invalid_argument);
+    EXPECT_EQ(accounts.getAccount("Sales Revenue").getBalance(), 100);
+}
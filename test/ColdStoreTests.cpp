@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/ColdStore.h"
+#include "../header/AccountDisplayer.h"
+#include "../header/ProgramManager.h"
+#include "../header/Snapshot.h"
+#include "TestEntries.h"
+
+#include <filesystem>
+
+#include <sstream>
+using std::ostringstream;
+
+#include <stdexcept>
+using std::invalid_argument;
+
+#include <string>
+using std::string;
+
+static string storeDirectory(const string& name) {
+    string path = ::testing::TempDir() + "ColdStoreTests_" + name;
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path;
+}
+
+//Two sales a month of the year, so every month has detail to compact
+static void postYear(ProgramManager& program) {
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.addAccount("Common Stock", StockholdersEquity, 1000);
+    for(DateUnit month = 1; month <= 12; ++month) {
+        for(DateUnit day : {20u, 5u}) {
+            post(program, Date(2024, month, day), Money(month * 10 + day), "Cash", "Sales Revenue", "Sale " + std::to_string(month) + "/" + std::to_string(day));
+        }
+    }
+}
+
+TEST(ColdStoreTests, testCompactKeepsBalances) {
+    ProgramManager program(2024);
+    postYear(program);
+    ColdStore cold(&program.getAccountLibrary(), storeDirectory("balances"));
+    program.setColdStore(&cold);
+    const Account& cash = program.getAccountLibrary().getAccount("Cash");
+    Money ending = cash.getBalance();
+    Money endOfMarch = cash.getRecords().getQuarterRecords()[0].getEndingBalance();
+    Money midFebruary = cash.getBalanceAsOf(Date(2024, 2, 10));
+
+    EXPECT_EQ(program.compactThrough(3), 6);
+    EXPECT_EQ(cold.getCompactedThrough(), 3);
+    EXPECT_EQ(program.getJournal().getEntries().size(), 18);
+    EXPECT_EQ(program.getJournal().getLines().size(), 36);
+    EXPECT_EQ(cash.getEntries().size(), 18);
+    EXPECT_EQ(cash.getMonthsEntries(2).size(), 0);
+    EXPECT_EQ(cash.getMonthsEntries(4).size(), 2);
+
+    //Period, daily and derived balances are untouched
+    EXPECT_EQ(cash.getBalance(), ending);
+    EXPECT_EQ(cash.getRecords().getQuarterRecords()[0].getEndingBalance(), endOfMarch);
+    EXPECT_EQ(cash.getBalanceAsOf(Date(2024, 2, 10)), midFebruary);
+    EXPECT_TRUE(program.getTrialBalance().isBalanced());
+
+    //Closed months take no more entries, later ones still do
+    for(Date day : {Date(2024, 3, 31), Date(2024, 4, 1)}) {
+        EXPECT_EQ(program.postEntry(makeEntry(program.getAccountLibrary(), day, 1, "Cash", "Sales Revenue", "Late sale")), day.getMonth() == 4);
+    }
+
+    EXPECT_THROW(program.compactThrough(2), invalid_argument);
+    EXPECT_EQ(program.compactThrough(6), 7);
+    EXPECT_EQ(cold.getSegmentCount(), 2);
+    EXPECT_THROW(Snapshot::write(storeDirectory("snapshot") + "/year.snap", program), invalid_argument);
+}
+
+TEST(ColdStoreTests, testDisplayLoadsDetailLazily) {
+    ProgramManager program(2024);
+    postYear(program);
+    Account& cash = program.getAccountLibrary().getAccount("Cash");
+    Period firstHalf(Date(2024, 1, 1), Date(2024, 6, 30));
+    ostringstream before;
+    AccountDisplayer(&cash, firstHalf).display(before);
+
+    ColdStore cold(&program.getAccountLibrary(), storeDirectory("display"));
+    program.setColdStore(&cold);
+    program.compactThrough(2);
+    program.compactThrough(4);
+    EXPECT_FALSE(cold.isLoaded(1));
+
+    //Without the store compacted months show balances only, with it the report is unchanged
+    ostringstream withoutDetail, withDetail;
+    AccountDisplayer(&cash, firstHalf).display(withoutDetail);
+    EXPECT_EQ(withoutDetail.str().find("Sale 1/5"), string::npos);
+    EXPECT_NE(withoutDetail.str().find("Sale 5/5"), string::npos);
+    AccountDisplayer(&cash, firstHalf, &cold).display(withDetail);
+    EXPECT_EQ(withDetail.str(), before.str());
+    EXPECT_TRUE(cold.isLoaded(1));
+    EXPECT_TRUE(cold.isLoaded(4));
+
+    //Loaded lines come back in date order per account
+    EntryView february = cold.getEntries(cash.getId(), 2);
+    ASSERT_EQ(february.size(), 2);
+    EXPECT_EQ(february[0]->getDate(), Date(2024, 2, 5));
+    EXPECT_EQ(february[1]->getDate(), Date(2024, 2, 20));
+    EXPECT_EQ(cold.getEntries(cash.getId(), 7).size(), 0);
+}
+
+TEST(ColdStoreTests, testDisplayWithoutStoreKeepsRunningBalance) {
+    ProgramManager program(2024);
+    postYear(program);
+    Account& cash = program.getAccountLibrary().getAccount("Cash");
+    Period year(Date(2024, 1, 1), Date(2024, 12, 31));
+    ostringstream before;
+    AccountDisplayer(&cash, year).display(before);
+
+    ColdStore cold(&program.getAccountLibrary(), storeDirectory("running"));
+    program.setColdStore(&cold);
+    program.compactThrough(3);
+
+    //Rows after the compacted months show the same running balance as before compaction
+    ostringstream after;
+    AccountDisplayer(&cash, year).display(after);
+    auto rowOf = [](const string& report, const string& description) {
+        size_t end = report.find("| " + description + "\n");
+        size_t start = report.rfind('\n', end) + 1;
+        return report.substr(start, end - start);
+    };
+    EXPECT_EQ(after.str().find("Sale 3/20"), string::npos);
+    for(const char* row : {"Sale 4/5", "Sale 4/20", "Sale 12/20"}) {
+        EXPECT_EQ(rowOf(after.str(), row), rowOf(before.str(), row)) << row;
+    }
+    EXPECT_EQ(after.str().substr(after.str().rfind("12/31/2024")), before.str().substr(before.str().rfind("12/31/2024")));
+}
+
+TEST(ColdStoreTests, testRequiresStore) {
+    ProgramManager program(2024);
+    postYear(program);
+    EXPECT_THROW(program.compactThrough(1), invalid_argument);
+    EXPECT_EQ(program.getJournal().getEntries().size(), 24);
+
+    ColdStore cold(&program.getAccountLibrary(), storeDirectory("requires"));
+    program.setColdStore(&cold);
+    EXPECT_THROW(program.compactThrough(13), invalid_argument);
+    EXPECT_EQ(program.getJournal().getFrozenMonths(), 0);
+}
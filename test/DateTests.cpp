@@ -5,8 +5,10 @@ using ::testing::_;
 using ::testing::InSequence;
 
 #include "../header/Date.h"
+#include "AllocationCounter.h"
 
 
+#include <sstream>
 #include <stdexcept>
 #include <string>
 using std::string;
@@ -15,61 +17,61 @@ using std::invalid_argument;
 TEST(dateTests, testDateNumberConstructor1) {
     DateUnit year = 2000, month = 1, day = 1;
     Date d(year, month, day);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateNumberConstructor2) {
     DateUnit year = 2000, month = 1, day = 2;
     Date d(year, month, day);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateNumberConstructor3) {
     DateUnit year = 873, month = 6, day = 16;
     Date d(year, month, day);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateStringConstructor1) {
     string date = "01/01/2000";
     DateUnit year = 2000, month = 1, day = 1;
     Date d(date);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateStringConstructor2) {
     string date = "01/02/2000";
     DateUnit year = 2000, month = 1, day = 2;
     Date d(date);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateStringConstructor3) {
     string date = "06/16/0873";
     DateUnit year = 873, month = 6, day = 16;
     Date d(date);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateStringConstructor4) {
     string date = "11/16/0873";
     DateUnit year = 873, month = 11, day = 16;
     Date d(date);
-    EXPECT_EQ(d.year, year);
-    EXPECT_EQ(d.month, month);
-    EXPECT_EQ(d.day, day);
+    EXPECT_EQ(d.getYear(), year);
+    EXPECT_EQ(d.getMonth(), month);
+    EXPECT_EQ(d.getDay(), day);
 }
 
 TEST(dateTests, testDateStringForm1) {
@@ -96,6 +98,12 @@ TEST(dateTests, testDateStringForm4) {
     EXPECT_EQ(date, d.stringForm());
 }
 
+TEST(dateTests, testStreamOutput) {
+    std::ostringstream out;
+    out << Date(2024, 3, 7) << " " << Date("12/31/0999");
+    EXPECT_EQ(out.str(), "03/07/2024 12/31/0999");
+}
+
 TEST(dateTests, testObviousThrow) {
     string date = "ab/cd/efgh";
     EXPECT_THROW(Date d(date), invalid_argument);
@@ -171,4 +179,83 @@ TEST(dateTests, testNoEquality) {
     string date1 = "01/05/2003", date2 = "01/05/2004";
     Date d1(date1), d2(date2);
     EXPECT_NE(d1, d2);
-}
\ No newline at end of file
+}
+
+TEST(dateTests, testOrdering) {
+    Date d1("01/05/2003"), d2("01/06/2003"), d3("02/01/2003"), d4("12/31/2002");
+    EXPECT_LT(d1, d2);
+    EXPECT_LT(d2, d3);
+    EXPECT_LT(d4, d1);
+    EXPECT_GT(d3, d4);
+    EXPECT_LE(d1, Date(2003, 1, 5));
+    EXPECT_LT(d1.getOrdinal(), d3.getOrdinal());
+}
+
+TEST(dateTests, testPeriodIndices) {
+    Date d("08/17/2001");
+    EXPECT_EQ(d.getQuarter(), 3);
+    EXPECT_EQ(d.getQuarterIndex(), 2);
+    EXPECT_EQ(d.getMonthIndex(), 7);
+    EXPECT_EQ(d.getMonthInQuarter(), 1);
+
+    static_assert(Date(2024, 12, 31).getQuarter() == 4);
+    static_assert(Date(2024, 3, 1) < Date(2024, 4, 1));
+}
+
+TEST(dateTests, testNumberConstructorThrow) {
+    EXPECT_THROW(Date(2001, 13, 1), invalid_argument);
+    EXPECT_THROW(Date(2001, 1, 32), invalid_argument);
+}
+
+
+TEST(dateTests, testCalendarValidation) {
+    EXPECT_NO_THROW(Date("02/29/2024"));
+    EXPECT_NO_THROW(Date("02/29/2000"));
+    EXPECT_NO_THROW(Date("04/30/2023"));
+    EXPECT_THROW(Date("02/29/2023"), invalid_argument);
+    EXPECT_THROW(Date("02/29/1900"), invalid_argument);
+    EXPECT_THROW(Date("04/31/2023"), invalid_argument);
+    EXPECT_THROW(Date("00/10/2023"), invalid_argument);
+    EXPECT_THROW(Date("13/10/2023"), invalid_argument);
+    EXPECT_THROW(Date("01/00/2023"), invalid_argument);
+    EXPECT_THROW(Date("01-05-2023"), invalid_argument);
+}
+
+TEST(dateTests, testTryParse) {
+    Date parsed(2000, 1, 1);
+    ASSERT_TRUE(Date::tryParse("12/31/2024", parsed));
+    EXPECT_EQ(parsed, Date(2024, 12, 31));
+
+    EXPECT_FALSE(Date::tryParse("12/32/2024", parsed));
+    EXPECT_EQ(parsed, Date(2024, 12, 31));
+}
+
+TEST(dateTests, testFormatBuffer) {
+    char buffer[Date::STRING_LENGTH + 1] = {};
+    char* end = Date(873, 6, 16).format(buffer);
+    EXPECT_EQ(end, buffer + Date::STRING_LENGTH);
+    EXPECT_EQ(string(buffer), "06/16/0873");
+}
+
+TEST(dateTests, testParseAndFormatDoNotAllocate) {
+    const char* text = "07/04/2024";
+    char buffer[Date::STRING_LENGTH];
+    Date parsed(2000, 1, 1);
+
+    size_t allocationsBefore = AllocationCounter::getAllocations();
+    for(unsigned i = 0; i < 1000; ++i) {
+        Date::tryParse(text, parsed);
+        Date constructed(text);
+        constructed.format(buffer);
+    }
+    EXPECT_EQ(AllocationCounter::getAllocations() - allocationsBefore, 0);
+    EXPECT_EQ(string(buffer, Date::STRING_LENGTH), text);
+}
+
+TEST(dateTests, testDayOfYear) {
+    EXPECT_EQ(Date("01/01/2023").getDayOfYear(), 0);
+    EXPECT_EQ(Date("03/01/2023").getDayOfYear(), 59);
+    EXPECT_EQ(Date("03/01/2024").getDayOfYear(), 60);
+    EXPECT_EQ(Date("12/31/2023").getDayOfYear(), 364);
+    EXPECT_EQ(Date("12/31/2024").getDayOfYear(), 365);
+}
@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/FinancialStatements.h"
+#include "../header/ProgramManager.h"
+#include "TestEntries.h"
+
+#include <sstream>
+using std::ostringstream;
+
+#include <stdexcept>
+using std::invalid_argument;
+
+//Chart with an opening balance sheet of 1500 and one posting of each nominal kind spread over the first two quarters
+static void buildLedger(ProgramManager& program) {
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Equipment", Asset, 600);
+    accounts.linkAccount("Equipment", "Accumulated Depreciation", ContraAsset, 100);
+    accounts.addAccount("Accounts Payable", Liability, 500);
+    accounts.addAccount("Common Stock", StockholdersEquity, 1000);
+    accounts.addAccount("Sales Revenue", Revenue);
+    accounts.linkAccount("Sales Revenue", "Sales Returns", ContraRevenue);
+    accounts.addAccount("Depreciation Expense", Expense);
+    accounts.addAccount("Gain on Sale", GAIN);
+    accounts.addAccount("Loss on Disposal", LOSS);
+    accounts.addAccount("Dividends", Dividends);
+
+    post(program, Date(2024, 1, 10), 800, "Cash", "Sales Revenue");
+    post(program, Date(2024, 2, 10), 50, "Sales Returns", "Cash");
+    post(program, Date(2024, 3, 31), 60, "Depreciation Expense", "Accumulated Depreciation");
+    post(program, Date(2024, 4, 5), 40, "Cash", "Gain on Sale");
+    post(program, Date(2024, 5, 5), 15, "Loss on Disposal", "Cash");
+    post(program, Date(2024, 6, 30), 100, "Dividends", "Cash");
+}
+
+TEST(FinancialStatementsTests, testRunningTotals) {
+    ProgramManager program(2024);
+    buildLedger(program);
+    const FinancialStatements& statements = program.getStatements();
+
+    EXPECT_EQ(statements.getTotal(StatementCategory::Assets), 1000 + 800 - 50 + 40 - 15 - 100 + 600 - 160);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Liabilities), 500);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Equity), 1000);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Revenues), 750);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Expenses), 60);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Gains), 40);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Losses), 15);
+    EXPECT_EQ(statements.getTotal(StatementCategory::Dividends), 100);
+    EXPECT_EQ(statements.getNetIncome(), 750 - 60 + 40 - 15);
+
+    //Totals built afterwards from account balances agree
+    ClosingEngine rebuiltTotals(&program.getAccountLibrary());
+    FinancialStatements rebuilt(&program.getAccountLibrary(), &rebuiltTotals);
+    for(size_t i = 0; i < STATEMENT_CATEGORY_COUNT; ++i) {
+        EXPECT_EQ(rebuilt.getTotal(StatementCategory(i)), statements.getTotal(StatementCategory(i)));
+    }
+}
+
+TEST(FinancialStatementsTests, testPeriodTotals) {
+    ProgramManager program(2024);
+    buildLedger(program);
+    const FinancialStatements& statements = program.getStatements();
+
+    EXPECT_EQ(statements.getPeriodChange(StatementCategory::Revenues, PeriodLength::Month, 1), 800);
+    EXPECT_EQ(statements.getPeriodChange(StatementCategory::Revenues, PeriodLength::Month, 2), -50);
+    EXPECT_EQ(statements.getPeriodChange(StatementCategory::Revenues, PeriodLength::Quarter, 1), 750);
+    EXPECT_EQ(statements.getPeriodChange(StatementCategory::Revenues, PeriodLength::Quarter, 2), 0);
+    EXPECT_EQ(statements.getPeriodChange(StatementCategory::Gains, PeriodLength::Quarter, 2), 40);
+    EXPECT_EQ(statements.getPeriodChange(StatementCategory::Expenses, PeriodLength::Year, 1), 60);
+
+    EXPECT_EQ(statements.getEndingTotal(StatementCategory::Assets, PeriodLength::Month, 1), 1000 + 800 + 500);
+    EXPECT_EQ(statements.getEndingTotal(StatementCategory::Assets, PeriodLength::Quarter, 1), 1000 + 750 + 600 - 160);
+    EXPECT_EQ(statements.getEndingTotal(StatementCategory::Assets, PeriodLength::Year, 1), statements.getTotal(StatementCategory::Assets));
+
+    EXPECT_EQ(statements.getPeriod(PeriodLength::Quarter, 1).getEndDate(), Date(2024, 3, 31));
+    EXPECT_EQ(statements.getPeriod(PeriodLength::Month, 2).getEndDate(), Date(2024, 2, 29));
+    EXPECT_THROW(statements.getPeriod(PeriodLength::Month, 13), invalid_argument);
+    EXPECT_THROW(statements.getEndingTotal(StatementCategory::Assets, PeriodLength::Quarter, 0), invalid_argument);
+}
+
+TEST(FinancialStatementsTests, testRenderBalanceSheet) {
+    ProgramManager program(2024);
+    buildLedger(program);
+
+    ostringstream output;
+    program.getStatements().renderBalanceSheet(output, PeriodLength::Quarter, 1);
+    string text = output.str();
+    EXPECT_NE(text.find("---BALANCE SHEET AS OF 03/31/2024---"), string::npos);
+    EXPECT_NE(text.find("  Accumulated Depreciation"), string::npos);
+    EXPECT_NE(text.find("-160.00"), string::npos);
+    //Assets of 2190 equal 500 of liabilities, 1000 of stock and 690 of income not yet closed
+    EXPECT_NE(text.find("Total Assets"), string::npos);
+    EXPECT_NE(text.find("2190.00"), string::npos);
+    EXPECT_NE(text.find("690.00"), string::npos);
+    EXPECT_EQ(text.find("2190.00"), text.find("2190.00", text.find("Total Assets")));
+    EXPECT_NE(text.find("2190.00", text.find("Total Liabilities and Equity")), string::npos);
+}
+
+TEST(FinancialStatementsTests, testRenderIncomeStatement) {
+    ProgramManager program(2024);
+    buildLedger(program);
+
+    ostringstream output;
+    program.getStatements().renderIncomeStatement(output, PeriodLength::Year);
+    string text = output.str();
+    EXPECT_NE(text.find("---INCOME STATEMENT 01/01/2024 TO 12/31/2024---"), string::npos);
+    EXPECT_NE(text.find("Total Revenues"), string::npos);
+    EXPECT_NE(text.find("750.00", text.find("Total Revenues")), string::npos);
+    EXPECT_NE(text.find("715.00", text.find("Net Income")), string::npos);
+    //Balance sheet lines stay off the income statement
+    EXPECT_EQ(text.find("Cash"), string::npos);
+}
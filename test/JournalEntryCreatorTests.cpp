@@ -35,4 +35,27 @@ TEST(JournalEntryCreatorTests, testJournalEntryCreator) {
     EXPECT_EQ(created.getModifications().front().get().second, debit);
     EXPECT_EQ(created.getModifications().back().get().first, 500);
     EXPECT_EQ(created.getModifications().back().get().second, credit);
-}
\ No newline at end of file
+}
+TEST(JournalEntryCreatorTests, testRelease) {
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", Asset, 500);
+    accounts.addAccount("Accounts Receivable", Asset, 500);
+
+    JournalEntryCreator unbalanced(Date("01/01/2024"), "Collect $500 cash from Accounts Receivable");
+    JournalModificationCreator modificationCreator(&accounts, Date("01/01/2024"), unbalanced.getSharedDescription());
+    unbalanced.addJournalModification(modificationCreator.getJournalModification("dr. Cash, 500"));
+    EXPECT_THROW({
+        unbalanced.release();
+    }, runtime_error);
+
+    JournalEntryCreator entryCreator(Date("01/01/2024"), "Collect $500 cash from Accounts Receivable");
+    entryCreator.addJournalModification(modificationCreator.getJournalModification("dr. Cash, 500"));
+    entryCreator.addJournalModification(modificationCreator.getJournalModification("cr. Accounts Receivable, 500"));
+    const JournalModification* firstLine = &entryCreator.create().getModifications().front();
+
+    //The built lines move out with the entry rather than being copied
+    JournalEntry released = entryCreator.release();
+    EXPECT_TRUE(released.validate());
+    ASSERT_EQ(released.getModifications().size(), 2);
+    EXPECT_EQ(&released.getModifications().front(), firstLine);
+}
@@ -5,6 +5,10 @@ using ::testing::_;
 using ::testing::InSequence;
 
 #include "../header/JournalEntryPoster.h"
+#include "AllocationCounter.h"
+
+#include <vector>
+using std::vector;
 
 TEST(JournalEntryPosterTests, testJournalPoster) {
     Journal journal(2024);
@@ -89,4 +93,170 @@ TEST(JournalEntryPosterTests, testJournalPoster) {
     EXPECT_TRUE(entryPoster.postModification(cje));
 
     EXPECT_EQ(accounts.getAccount("depreciation expense").getBalance(), 0);
-}
\ No newline at end of file
+}
+TEST(JournalEntryPosterTests, testPostingStats) {
+    Journal journal(2024);
+    AccountLibrary accounts(2024);
+    JournalEntryPoster entryPoster(&journal, &accounts);
+    accounts.addAccount("Cash", AccountType::Asset, 5000);
+    accounts.addAccount("Notes Payable", AccountType::Liability, 0);
+    entryPoster.setTiming(true);
+
+    JournalEntry unbalanced(Date("02/01/2024"), "Borrow $1000");
+    unbalanced.addModification(JournalModification(1000, ValueType::debit, unbalanced.getDate(), unbalanced.getSharedDescription(), &accounts.getAccount("Cash")));
+    EXPECT_FALSE(entryPoster.postModification(unbalanced));
+
+    JournalEntry wrongYear(Date("02/01/2025"), "Borrow $1000");
+    wrongYear.addModification(JournalModification(1000, ValueType::debit, wrongYear.getDate(), wrongYear.getSharedDescription(), &accounts.getAccount("Cash")));
+    wrongYear.addModification(JournalModification(1000, ValueType::credit, wrongYear.getDate(), wrongYear.getSharedDescription(), &accounts.getAccount("Notes Payable")));
+    EXPECT_FALSE(entryPoster.postModification(wrongYear));
+
+    unbalanced.addModification(JournalModification(1000, ValueType::credit, unbalanced.getDate(), unbalanced.getSharedDescription(), &accounts.getAccount("Notes Payable")));
+    EXPECT_TRUE(entryPoster.postModification(unbalanced));
+
+    const PostingStats& stats = entryPoster.getStats();
+    EXPECT_EQ(stats.entriesPosted, 1);
+    EXPECT_EQ(stats.entriesRejected, 2);
+    EXPECT_EQ(stats.linesApplied, 2);
+    EXPECT_GT(stats.applyTime.count(), 0);
+
+    entryPoster.resetStats();
+    EXPECT_EQ(entryPoster.getStats().entriesPosted, 0);
+    EXPECT_EQ(entryPoster.getStats().applyTime.count(), 0);
+}
+
+TEST(JournalEntryPosterTests, testPostingAllocations) {
+    const size_t lineCount = 40;
+    Journal journal(2024);
+    AccountLibrary accounts(2024);
+    JournalEntryPoster entryPoster(&journal, &accounts);
+    for(size_t i = 0; i < lineCount; ++i) accounts.addAccount("Account " + std::to_string(i), AccountType::Asset, 0);
+
+    auto buildEntry = [&](const Date& day) {
+        JournalEntry entry(day, "Reclassify balances across every account in the chart");
+        for(size_t i = 0; i < lineCount; ++i) {
+            entry.addModification(JournalModification(10, i < lineCount / 2 ? ValueType::debit : ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount("Account " + std::to_string(i))));
+        }
+        return entry;
+    };
+
+    //Five postings leave each account's entry store at capacity 8, so the next two append without growing it
+    for(DateUnit day = 1; day <= 5; ++day) ASSERT_TRUE(entryPoster.postModification(buildEntry(Date(2024, 1, day))));
+
+    //Lines land in the journal's arena either way: moved entries hand theirs over, copied ones are copied in place
+    JournalEntry moved = buildEntry(Date(2024, 1, 6));
+    size_t allocationsBefore = AllocationCounter::getAllocations();
+    ASSERT_TRUE(entryPoster.postModification(std::move(moved)));
+    EXPECT_EQ(AllocationCounter::getAllocations() - allocationsBefore, 0);
+
+    JournalEntry copied = buildEntry(Date(2024, 1, 7));
+    allocationsBefore = AllocationCounter::getAllocations();
+    ASSERT_TRUE(entryPoster.postModification(static_cast<const JournalEntry&>(copied)));
+    EXPECT_EQ(AllocationCounter::getAllocations() - allocationsBefore, 0);
+    EXPECT_EQ(copied.getModifications().size(), lineCount);
+
+    EXPECT_EQ(journal.getEntries().size(), 7);
+    EXPECT_EQ(accounts.getAccount("Account 0").getEntries().size(), 7);
+    EXPECT_EQ(accounts.getAccount("Account 0").getBalance(), 70);
+}
+
+TEST(JournalEntryPosterTests, testPostBatchMatchesSerial) {
+    Journal serialJournal(2024), batchJournal(2024);
+    AccountLibrary serialAccounts(2024), batchAccounts(2024);
+    JournalEntryPoster serialPoster(&serialJournal, &serialAccounts), batchPoster(&batchJournal, &batchAccounts);
+    for(AccountLibrary* accounts : {&serialAccounts, &batchAccounts}) {
+        accounts->addAccount("Cash", AccountType::Asset, 1000);
+        accounts->addAccount("Sales", AccountType::Revenue, 0);
+        accounts->addAccount("Supplies", AccountType::Asset, 0);
+    }
+
+    auto buildEntries = [](AccountLibrary& accounts) {
+        vector<JournalEntry> entries;
+        for(unsigned i = 0; i < 30; ++i) {
+            Date day(2024, (i * 5) % 12 + 1, i % 28 + 1);
+            JournalEntry entry(day, "Batch entry " + std::to_string(i));
+            entry.addModification(JournalModification(i + 1, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount(i % 2 ? "Cash" : "Supplies")));
+            entry.addModification(JournalModification(i + 1, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount(i % 3 ? "Sales" : "Cash")));
+            entries.push_back(std::move(entry));
+        }
+        //Unbalanced and wrong year entries are skipped without stopping the batch
+        JournalEntry unbalanced(Date("05/05/2024"), "Unbalanced");
+        unbalanced.addModification(JournalModification(1, ValueType::debit, unbalanced.getDate(), unbalanced.getSharedDescription(), &accounts.getAccount("Cash")));
+        entries.insert(entries.begin() + 10, std::move(unbalanced));
+        return entries;
+    };
+
+    vector<JournalEntry> serialEntries = buildEntries(serialAccounts);
+    for(JournalEntry& entry : serialEntries) serialPoster.postModification(std::move(entry));
+    vector<JournalEntry> batchEntries = buildEntries(batchAccounts);
+    EXPECT_EQ(batchPoster.postBatch(batchEntries), 30);
+
+    EXPECT_EQ(batchPoster.getStats().entriesPosted, 30);
+    EXPECT_EQ(batchPoster.getStats().entriesRejected, 1);
+    EXPECT_EQ(batchPoster.getStats().linesApplied, 60);
+    EXPECT_EQ(batchJournal.getEntries().size(), serialJournal.getEntries().size());
+    EXPECT_FALSE(batchEntries[10].isJournalized());
+    EXPECT_EQ(batchEntries[10].getModifications().size(), 1);
+
+    for(const char* name : {"Cash", "Sales", "Supplies"}) {
+        const Account& serial = serialAccounts.getAccount(name);
+        const Account& batched = batchAccounts.getAccount(name);
+        EXPECT_EQ(batched.getBalance(), serial.getBalance()) << name;
+        ASSERT_EQ(batched.getEntries().size(), serial.getEntries().size()) << name;
+        for(size_t i = 0; i < serial.getEntries().size(); ++i) {
+            EXPECT_EQ(batched.getEntries()[i]->getDescription(), serial.getEntries()[i]->getDescription()) << name << " entry " << i;
+        }
+        for(DateUnit month = 1; month <= 12; ++month) {
+            Date monthEnd(2024, month, Date::daysInMonth(2024, month));
+            EXPECT_EQ(batched.getBalanceAsOf(monthEnd), serial.getBalanceAsOf(monthEnd)) << name << " month " << month;
+            EXPECT_EQ(batched.getRecords().getMonthRecords(month).getEndingBalance(), serial.getRecords().getMonthRecords(month).getEndingBalance()) << name << " month " << month;
+        }
+    }
+}
+
+TEST(JournalEntryPosterTests, testParallelBatchMatchesSerial) {
+    const unsigned accountCount = 12;
+    Journal serialJournal(2024), parallelJournal(2024);
+    AccountLibrary serialAccounts(2024), parallelAccounts(2024);
+    JournalEntryPoster serialPoster(&serialJournal, &serialAccounts), parallelPoster(&parallelJournal, &parallelAccounts);
+    ThreadPool pool(4);
+    parallelPoster.setThreadPool(&pool);
+    for(AccountLibrary* accounts : {&serialAccounts, &parallelAccounts}) {
+        accounts->addAccount("Cash", AccountType::Asset, 1000);
+        for(unsigned i = 0; i < accountCount; ++i) accounts->addAccount("Expense " + std::to_string(i), AccountType::Expense, 0);
+    }
+
+    //Every entry credits Cash, so one account carries half of all lines while the expenses split the rest unevenly
+    auto buildEntries = [&](AccountLibrary& accounts) {
+        vector<JournalEntry> entries;
+        for(unsigned i = 0; i < 200; ++i) {
+            Date day(2024, (i * 7) % 12 + 1, (i * 11) % 28 + 1);
+            JournalEntry entry(day, "Parallel entry " + std::to_string(i));
+            Account& expense = accounts.getAccount("Expense " + std::to_string((i * i) % accountCount));
+            entry.addModification(JournalModification(i + 1, ValueType::debit, day, entry.getSharedDescription(), &expense));
+            entry.addModification(JournalModification(i + 1, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount("Cash")));
+            entries.push_back(std::move(entry));
+        }
+        return entries;
+    };
+
+    vector<JournalEntry> serialEntries = buildEntries(serialAccounts);
+    EXPECT_EQ(serialPoster.postBatch(serialEntries), 200);
+    vector<JournalEntry> parallelEntries = buildEntries(parallelAccounts);
+    EXPECT_EQ(parallelPoster.postBatch(parallelEntries), 200);
+    EXPECT_EQ(parallelPoster.getStats().linesApplied, 400);
+
+    for(AccountId id = 0; id < serialAccounts.getAccountCount(); ++id) {
+        const Account& serial = serialAccounts.getAccount(id);
+        const Account& parallel = parallelAccounts.getAccount(id);
+        EXPECT_EQ(parallel.getBalance(), serial.getBalance()) << serial.getName();
+        ASSERT_EQ(parallel.getEntries().size(), serial.getEntries().size()) << serial.getName();
+        for(size_t i = 0; i < serial.getEntries().size(); ++i) {
+            EXPECT_EQ(parallel.getEntries()[i]->getDescription(), serial.getEntries()[i]->getDescription()) << serial.getName() << " entry " << i;
+        }
+        for(DateUnit month = 1; month <= 12; ++month) {
+            Date monthEnd(2024, month, Date::daysInMonth(2024, month));
+            EXPECT_EQ(parallel.getBalanceAsOf(monthEnd), serial.getBalanceAsOf(monthEnd)) << serial.getName() << " month " << month;
+        }
+    }
+}
@@ -53,4 +53,56 @@ TEST(JournalEntryTests, testAddModificationThrow) {
     EXPECT_THROW({
         entry.addModification(JournalModification(500, ValueType::credit, Date("01/01/2024"), "Collect $500 from Accounts Payable", &accountsReceivable));
     }, invalid_argument);
-}
\ No newline at end of file
+}
+
+TEST(JournalEntryTests, testFractionalAmountsBalance) {
+    JournalEntry entry(Date("01/01/2024"), "Split a $0.30 sale");
+    AssetAccount cash("Cash", 2024, 1000);
+    AssetAccount accountsReceivable("Accounts Receivable", 2024, 500);
+
+    entry.addModification(JournalModification(Money::parse("0.1"), ValueType::debit, Date("01/01/2024"), "Split a $0.30 sale", &cash));
+    entry.addModification(JournalModification(Money::parse("0.2"), ValueType::debit, Date("01/01/2024"), "Split a $0.30 sale", &cash));
+    entry.addModification(JournalModification(Money::parse("0.3"), ValueType::credit, Date("01/01/2024"), "Split a $0.30 sale", &accountsReceivable));
+    EXPECT_TRUE(entry.validate());
+}
+
+TEST(JournalEntryTests, testLinesShareDescription) {
+    JournalEntry entry(Date("01/01/2024"), "Collect $500 from Accounts Receivable");
+    AssetAccount cash("Cash", 2024, 1000);
+    AssetAccount accountsReceivable("Accounts Receivable", 2024, 500);
+
+    //One line built from its own equal string, one built from the entry's shared description
+    entry.addModification(JournalModification(500, ValueType::debit, Date("01/01/2024"), "Collect $500 from Accounts Receivable", &cash));
+    entry.addModification(JournalModification(500, ValueType::credit, Date("01/01/2024"), entry.getSharedDescription(), &accountsReceivable));
+
+    for(const auto& it : entry.getModifications()) {
+        EXPECT_EQ(it.getSharedDescription(), entry.getSharedDescription());
+        EXPECT_EQ(it.getDescription(), "Collect $500 from Accounts Receivable");
+    }
+
+    //Copies of the entry keep pointing at the same text rather than duplicating it
+    JournalEntry copy = entry;
+    EXPECT_EQ(copy.getModifications().front().getSharedDescription(), entry.getSharedDescription());
+}
+
+TEST(JournalEntryTests, testCachedImbalance) {
+    JournalEntry entry(Date("01/01/2024"), "Pay $75 of a $100 bill");
+    AssetAccount cash("Cash", 2024, 1000);
+    AssetAccount prepaid("Prepaid Expenses", 2024, 0);
+
+    EXPECT_EQ(entry.getImbalance(), 0);
+    entry.addModification(JournalModification(100, ValueType::debit, entry.getDate(), entry.getSharedDescription(), &prepaid));
+    EXPECT_EQ(entry.getImbalance(), 100);
+    entry.addModification(JournalModification(75, ValueType::credit, entry.getDate(), entry.getSharedDescription(), &cash));
+    EXPECT_EQ(entry.getImbalance(), 25);
+    EXPECT_FALSE(entry.validate());
+
+    //A rejected line leaves the cached state untouched
+    EXPECT_THROW({
+        entry.addModification(JournalModification(25, ValueType::credit, Date("01/02/2024"), entry.getSharedDescription(), &cash));
+    }, invalid_argument);
+    EXPECT_EQ(entry.getImbalance(), 25);
+
+    entry.addModification(JournalModification(25, ValueType::credit, entry.getDate(), entry.getSharedDescription(), &cash));
+    EXPECT_TRUE(entry.validate());
+}
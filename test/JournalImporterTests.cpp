@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/JournalImporter.h"
+#include "../header/ProgramManager.h"
+
+#include <sstream>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+#include <string>
+using std::string;
+
+static void addChart(ProgramManager& program) {
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.addAccount("Supplies", Asset, 0);
+    accounts.addAlias("Sales Revenue", "Sales");
+}
+
+TEST(JournalImporterTests, testImportCsv) {
+    ProgramManager program(2024);
+    addChart(program);
+    JournalImporter importer(&program);
+    importer.import(
+        "date,entry,description,side,account,amount\n"
+        "01/05/2024,1,Cash sale,dr,Cash,150.25\n"
+        "01/05/2024,1,Cash sale,cr,Sales,150.25\n"
+        "\n"
+        "02/10/2024,2,\"Supplies, \"\"bulk\"\" order\",Dr.,supplies,40\r\n"
+        "02/10/2024,2,ignored after the first row,Cr.,CASH,40\r\n");
+
+    EXPECT_EQ(importer.getStats().rowsRead, 4);
+    EXPECT_EQ(importer.getStats().entriesPosted, 2);
+    EXPECT_EQ(importer.getStats().entriesRejected, 0);
+    const AccountLibrary& accounts = program.getAccountLibrary();
+    EXPECT_EQ(accounts.getAccount("Cash").getBalance(), Money::parse("1110.25"));
+    EXPECT_EQ(accounts.getAccount("Sales Revenue").getBalance(), Money::parse("150.25"));
+    EXPECT_EQ(accounts.getAccount("Supplies").getBalance(), 40);
+    ASSERT_EQ(program.getJournal().getEntries().size(), 2);
+    EXPECT_EQ(program.getJournal().getEntries()[1].getDescription(), "Supplies, \"bulk\" order");
+    EXPECT_EQ(program.getJournal().getEntries()[1].getDate(), Date("02/10/2024"));
+}
+
+TEST(JournalImporterTests, testImportTsvInSmallBatches) {
+    ProgramManager program(2024);
+    addChart(program);
+    JournalImporter importer(&program, '\t', 1);
+    importer.import(
+        "03/01/2024\tA\tFirst\tdr\tCash\t10\n"
+        "03/01/2024\tA\tFirst\tcr\tSales\t10\n"
+        "03/02/2024\tB\tUnbalanced\tdr\tCash\t5\n"
+        "03/02/2024\tB\tUnbalanced\tcr\tSales\t4\n"
+        "03/03/2024\tC\tThird, with a comma\tdr\tCash\t1\n"
+        "03/03/2024\tC\tThird, with a comma\tcr\tSales\t1");
+
+    EXPECT_EQ(importer.getStats().entriesPosted, 2);
+    EXPECT_EQ(importer.getStats().entriesRejected, 1);
+    EXPECT_EQ(program.getAccountLibrary().getAccount("Cash").getBalance(), 1011);
+    EXPECT_EQ(program.getJournal().getEntries().back().getDescription(), "Third, with a comma");
+}
+
+TEST(JournalImporterTests, testErrorsNameTheLine) {
+    ProgramManager program(2024);
+    addChart(program);
+    JournalImporter importer(&program, ',', 1);
+    try {
+        importer.import(
+            "01/05/2024,1,Cash sale,dr,Cash,10\n"
+            "01/05/2024,1,Cash sale,cr,Sales,10\n"
+            "01/06/2024,2,Bad account,dr,Land,10\n");
+        FAIL() << "Expected invalid_argument";
+    } catch(const invalid_argument& error) {
+        EXPECT_THAT(error.what(), ::testing::HasSubstr("Line 3"));
+    }
+    //The entry finished before the bad row is still posted
+    EXPECT_EQ(program.getJournal().getEntries().size(), 1);
+
+    EXPECT_THROW(importer.import("13/01/2024,3,Bad date,dr,Cash,10\n"), invalid_argument);
+    EXPECT_THROW(importer.import("01/01/2024,3,Bad side,xx,Cash,10\n"), invalid_argument);
+    EXPECT_THROW(importer.import("01/01/2024,3,Bad amount,dr,Cash,ten\n"), invalid_argument);
+    EXPECT_THROW(importer.import("01/01/2024,3,Too few,dr,Cash\n"), invalid_argument);
+    EXPECT_THROW(importer.import("01/01/2024,3,\"Unterminated,dr,Cash,10\n"), invalid_argument);
+    //A credit before a debit is refused by the entry itself
+    EXPECT_THROW(importer.import("01/01/2024,4,Order,cr,Cash,10\n01/01/2024,4,Order,dr,Sales,10\n"), invalid_argument);
+    EXPECT_EQ(program.getJournal().getEntries().size(), 1);
+}
+
+TEST(JournalImporterTests, testEachImportIsItsOwnFile) {
+    ProgramManager program(2024);
+    addChart(program);
+    JournalImporter importer(&program);
+    string header = "date,entry,description,side,account,amount\n";
+    importer.import(header + "01/05/2024,1,Cash sale,dr,Cash,10\n01/05/2024,1,Cash sale,cr,Sales,10\n");
+    std::istringstream second(header + "01/06/2024,2,Cash sale,dr,Cash,20\n01/06/2024,2,Cash sale,cr,Sales,20\n");
+    importer.import(second);
+    EXPECT_EQ(importer.getStats().rowsRead, 4);
+    EXPECT_EQ(importer.getStats().entriesPosted, 2);
+
+    //Line numbers in errors count from the start of the file being imported
+    try {
+        importer.import(header + "01/07/2024,3,Bad account,dr,Land,10\n");
+        FAIL() << "Expected invalid_argument";
+    } catch(const invalid_argument& error) {
+        EXPECT_THAT(error.what(), ::testing::HasSubstr("Line 2"));
+    }
+}
+
+TEST(JournalImporterTests, testStreamMatchesText) {
+    //Large enough that rows and entries straddle the stream's read blocks
+    string text;
+    for(unsigned i = 0; i < 40000; ++i) {
+        string date = Date(2024, i % 12 + 1, i % 28 + 1).stringForm();
+        string id = std::to_string(i);
+        text += date + "," + id + ",Streamed entry number " + id + ",dr,Supplies," + std::to_string(i % 97) + ".50\n";
+        text += date + "," + id + ",Streamed entry number " + id + ",cr,Cash," + std::to_string(i % 97) + ".50\n";
+    }
+    ASSERT_GT(text.size(), size_t(2) << 20);
+
+    ProgramManager fromText(2024), fromStream(2024);
+    addChart(fromText);
+    addChart(fromStream);
+    JournalImporter textImporter(&fromText), streamImporter(&fromStream);
+    textImporter.import(text);
+    std::istringstream in(text);
+    streamImporter.import(in);
+
+    EXPECT_EQ(streamImporter.getStats().rowsRead, 80000);
+    EXPECT_EQ(streamImporter.getStats().entriesPosted, 40000);
+    EXPECT_EQ(fromStream.getJournal().getEntries().size(), fromText.getJournal().getEntries().size());
+    EXPECT_EQ(fromStream.getAccountLibrary().getAccount("Cash").getBalance(), fromText.getAccountLibrary().getAccount("Cash").getBalance());
+    EXPECT_EQ(fromStream.getAccountLibrary().getAccount("Supplies").getEntries().size(), 40000);
+}
+
+TEST(JournalImporterTests, testStreamOfExactlyOneBlock) {
+    //The last row has no newline and ends exactly on the block boundary
+    string rows = "01/05/2024,1,Cash sale,dr,Cash,10\n01/05/2024,1,Cash sale,cr,Sales,10";
+    string text = string(JournalImporter::BLOCK_SIZE - rows.size(), '\n') + rows;
+    ASSERT_EQ(text.size(), JournalImporter::BLOCK_SIZE);
+
+    ProgramManager program(2024);
+    addChart(program);
+    JournalImporter importer(&program);
+    std::istringstream in(text);
+    importer.import(in);
+
+    EXPECT_EQ(importer.getStats().rowsRead, 2);
+    EXPECT_EQ(importer.getStats().entriesPosted, 1);
+    EXPECT_EQ(program.getAccountLibrary().getAccount("Sales Revenue").getBalance(), 10);
+}
+
+TEST(JournalImporterTests, testNamesFollowAliasChanges) {
+    ProgramManager program(2024);
+    addChart(program);
+    JournalImporter importer(&program);
+    importer.import("01/05/2024,1,Sale,dr,cash,10\n01/05/2024,1,Sale,cr,SALES,10\n");
+    EXPECT_EQ(importer.getStats().entriesPosted, 1);
+
+    //A removed alias stops resolving for an importer that already used it
+    program.getAccountLibrary().removeAlias("Sales");
+    EXPECT_THROW(importer.import("01/06/2024,2,Sale,dr,Cash,5\n01/06/2024,2,Sale,cr,Sales,5\n"), invalid_argument);
+    program.getAccountLibrary().addAlias("Cash", "Sales");
+    importer.import("01/07/2024,3,Transfer,dr,Supplies,5\n01/07/2024,3,Transfer,cr,sales,5\n");
+    EXPECT_EQ(importer.getStats().entriesPosted, 2);
+    EXPECT_EQ(program.getAccountLibrary().getAccount("Cash").getBalance(), 1005);
+}
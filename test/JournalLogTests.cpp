@@ -0,0 +1,252 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/JournalLog.h"
+#include "../header/ProgramManager.h"
+#include "TestEntries.h"
+
+#include <csignal>
+#include <cstdio>
+
+#include <sys/resource.h>
+
+#include <filesystem>
+
+#include <fstream>
+
+#include <stdexcept>
+using std::invalid_argument;
+using std::runtime_error;
+
+#include <string>
+using std::string;
+
+#include <vector>
+using std::vector;
+
+static string logPath(const string& name) {
+    string path = ::testing::TempDir() + "JournalLogTests_" + name + ".wal";
+    std::remove(path.c_str());
+    return path;
+}
+
+static void addChart(ProgramManager& program) {
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.addAccount("Supplies", Asset, 0);
+}
+
+static JournalEntry sale(ProgramManager& program, unsigned i) {
+    return makeEntry(program.getAccountLibrary(), Date(2024, i % 12 + 1, i % 28 + 1), Money::fromMinorUnits(100 * i + 5), "Cash", "Sales Revenue", "Sale " + std::to_string(i));
+}
+
+static void expectSameLedger(ProgramManager& recovered, ProgramManager& original) {
+    ASSERT_EQ(recovered.getJournal().getEntries().size(), original.getJournal().getEntries().size());
+    for(AccountId id = 0; id < original.getAccountLibrary().getAccountCount(); ++id) {
+        const Account& expected = original.getAccountLibrary().getAccount(id);
+        const Account& actual = recovered.getAccountLibrary().getAccount(id);
+        EXPECT_EQ(actual.getBalance(), expected.getBalance()) << expected.getName();
+        ASSERT_EQ(actual.getEntries().size(), expected.getEntries().size()) << expected.getName();
+        for(size_t i = 0; i < expected.getEntries().size(); ++i) {
+            EXPECT_EQ(actual.getEntries()[i]->getDescription(), expected.getEntries()[i]->getDescription());
+            EXPECT_EQ(actual.getEntries()[i]->getDate(), expected.getEntries()[i]->getDate());
+        }
+    }
+}
+
+static void appendBytes(const string& path, const string& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    file << bytes;
+}
+
+TEST(JournalLogTests, testRecoverReplaysPostings) {
+    string path = logPath("replay");
+    ProgramManager original(2024);
+    addChart(original);
+    {
+        JournalLog log(path, 2024);
+        original.setJournalLog(&log);
+        for(unsigned i = 0; i < 10; ++i) EXPECT_TRUE(original.postEntry(sale(original, i)));
+        vector<JournalEntry> batch;
+        for(unsigned i = 10; i < 20; ++i) batch.push_back(sale(original, i));
+        EXPECT_EQ(original.postEntries(batch), 10);
+        //Rejected entries never reach the log
+        JournalEntry unbalanced(Date("03/03/2024"), "Unbalanced");
+        unbalanced.addModification(JournalModification(1, ValueType::debit, unbalanced.getDate(), unbalanced.getSharedDescription(), &original.getAccountLibrary().getAccount("Cash")));
+        EXPECT_FALSE(original.postEntry(unbalanced));
+        EXPECT_EQ(log.getSyncCount(), 20);
+        original.setJournalLog(nullptr);
+    }
+
+    ProgramManager recovered(2024);
+    addChart(recovered);
+    EXPECT_EQ(JournalLog::recover(path, recovered), 20);
+    expectSameLedger(recovered, original);
+}
+
+TEST(JournalLogTests, testGroupCommit) {
+    string path = logPath("group");
+    ProgramManager original(2024);
+    addChart(original);
+    JournalLog log(path, 2024, 4);
+    original.setJournalLog(&log);
+    for(unsigned i = 0; i < 10; ++i) original.postEntry(sale(original, i));
+    EXPECT_EQ(log.getSyncCount(), 2);
+    EXPECT_EQ(log.getPendingRecords(), 2);
+
+    //Until the group is flushed its records are not on disk
+    ProgramManager beforeFlush(2024);
+    addChart(beforeFlush);
+    EXPECT_EQ(JournalLog::recover(path, beforeFlush), 8);
+
+    log.flush();
+    EXPECT_EQ(log.getSyncCount(), 3);
+    EXPECT_EQ(log.getPendingRecords(), 0);
+    ProgramManager afterFlush(2024);
+    addChart(afterFlush);
+    EXPECT_EQ(JournalLog::recover(path, afterFlush), 10);
+    expectSameLedger(afterFlush, original);
+}
+
+TEST(JournalLogTests, testTornTailIsDropped) {
+    string path = logPath("torn");
+    ProgramManager original(2024);
+    addChart(original);
+    {
+        JournalLog log(path, 2024);
+        original.setJournalLog(&log);
+        for(unsigned i = 0; i < 5; ++i) original.postEntry(sale(original, i));
+        original.setJournalLog(nullptr);
+    }
+    //A crash mid-write leaves a length prefix promising more bytes than follow
+    appendBytes(path, string("\x40\x00\x00\x00\x12\x34", 6));
+
+    ProgramManager recovered(2024);
+    addChart(recovered);
+    EXPECT_EQ(JournalLog::recover(path, recovered), 5);
+
+    //Reopening cuts the torn bytes off so later records stay readable
+    {
+        JournalLog log(path, 2024);
+        original.setJournalLog(&log);
+        original.postEntry(sale(original, 5));
+        original.setJournalLog(nullptr);
+    }
+    ProgramManager reopened(2024);
+    addChart(reopened);
+    EXPECT_EQ(JournalLog::recover(path, reopened), 6);
+    expectSameLedger(reopened, original);
+}
+
+TEST(JournalLogTests, testCorruptRecordStopsReplay) {
+    string path = logPath("corrupt");
+    ProgramManager original(2024);
+    addChart(original);
+    {
+        JournalLog log(path, 2024);
+        original.setJournalLog(&log);
+        for(unsigned i = 0; i < 3; ++i) original.postEntry(sale(original, i));
+        original.setJournalLog(nullptr);
+    }
+    //Flip one byte of the last record's description
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    file.seekp(size - 2 * (8 + 1 + 4) - 4 - 2);
+    file.put('#');
+    file.close();
+
+    ProgramManager recovered(2024);
+    addChart(recovered);
+    EXPECT_EQ(JournalLog::recover(path, recovered), 2);
+}
+
+TEST(JournalLogTests, testWrongFileRejected) {
+    string path = logPath("wrong");
+    { JournalLog log(path, 2023); }
+    EXPECT_THROW(JournalLog(path, 2024), invalid_argument);
+    ProgramManager program(2024);
+    EXPECT_THROW(JournalLog::recover(path, program), invalid_argument);
+
+    string other = logPath("notalog");
+    appendBytes(other, "mm/dd/yyyy, not a log at all");
+    EXPECT_THROW(JournalLog(other, 2024), invalid_argument);
+}
+
+TEST(JournalLogTests, testUnlibraryAccountRejected) {
+    string path = logPath("loose");
+    JournalLog log(path, 2024);
+    ProgramManager program(2024);
+    addChart(program);
+    AssetAccount loose("Loose", 2024, 0);
+    JournalEntry entry(Date("01/01/2024"), "Outside the chart");
+    entry.addModification(JournalModification(5, ValueType::debit, entry.getDate(), entry.getSharedDescription(), &loose));
+    entry.addModification(JournalModification(5, ValueType::credit, entry.getDate(), entry.getSharedDescription(), &program.getAccountLibrary().getAccount("Cash")));
+    EXPECT_THROW(log.append(entry), invalid_argument);
+    EXPECT_EQ(log.getPendingRecords(), 0);
+}
+
+TEST(JournalLogTests, testFailedLogWriteLeavesJournalUntouched) {
+    string path = logPath("full");
+    ProgramManager program(2024);
+    addChart(program);
+    JournalLog log(path, 2024);
+    program.setJournalLog(&log);
+    ASSERT_TRUE(program.postEntry(sale(program, 0)));
+    Money cash = program.getAccountLibrary().getAccount("Cash").getBalance();
+
+    //Capping the file at its current size makes every further write fail, as a full disk would
+    struct rlimit previous;
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &previous), 0);
+    struct rlimit capped = {static_cast<rlim_t>(std::filesystem::file_size(path)), previous.rlim_max};
+    auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &capped), 0);
+    EXPECT_THROW(program.postEntry(sale(program, 1)), runtime_error);
+    vector<JournalEntry> batch = {sale(program, 2), sale(program, 3)};
+    EXPECT_THROW(program.postEntries(batch), runtime_error);
+    setrlimit(RLIMIT_FSIZE, &previous);
+    std::signal(SIGXFSZ, previousHandler);
+
+    EXPECT_EQ(program.getJournal().getEntries().size(), 1);
+    EXPECT_EQ(program.getAccountLibrary().getAccount("Cash").getBalance(), cash);
+    EXPECT_EQ(program.getAccountLibrary().getAccount("Cash").getEntries().size(), 1);
+    EXPECT_EQ(log.getPendingRecords(), 0);
+
+    //The log keeps taking entries once writes succeed again, and replays exactly what was posted
+    ASSERT_TRUE(program.postEntry(sale(program, 4)));
+    program.setJournalLog(nullptr);
+    ProgramManager recovered(2024);
+    addChart(recovered);
+    EXPECT_EQ(JournalLog::recover(path, recovered), 2);
+    expectSameLedger(recovered, program);
+}
+
+TEST(JournalLogTests, testBatchStopsAtUnloggableEntry) {
+    string path = logPath("partial");
+    ProgramManager program(2024);
+    addChart(program);
+    JournalLog log(path, 2024);
+    program.setJournalLog(&log);
+    AssetAccount loose("Loose", 2024, 0);
+    vector<JournalEntry> batch;
+    batch.push_back(sale(program, 0));
+    batch.push_back(JournalEntry(Date("01/01/2024"), "Outside the chart"));
+    batch.back().addModification(JournalModification(5, ValueType::debit, batch.back().getDate(), batch.back().getSharedDescription(), &loose));
+    batch.back().addModification(JournalModification(5, ValueType::credit, batch.back().getDate(), batch.back().getSharedDescription(), &program.getAccountLibrary().getAccount("Cash")));
+    batch.push_back(sale(program, 1));
+    EXPECT_THROW(program.postEntries(batch), invalid_argument);
+
+    //The entry before the failure is posted in full, nothing after it is journalized
+    ASSERT_EQ(program.getJournal().getEntries().size(), 1);
+    EXPECT_EQ(program.getAccountLibrary().getAccount("Cash").getEntries().size(), 1);
+    EXPECT_EQ(loose.getEntries().size(), 0);
+    program.setJournalLog(nullptr);
+    ProgramManager recovered(2024);
+    addChart(recovered);
+    EXPECT_EQ(JournalLog::recover(path, recovered), 1);
+    expectSameLedger(recovered, program);
+}
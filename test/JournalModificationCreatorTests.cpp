@@ -49,4 +49,51 @@ TEST(JournalModificationCreatorTests, testModificationCreator) {
     EXPECT_THROW({
         auto modification = modificationCreator.getJournalModification("c Sales, a");
     }, invalid_argument);
-}
\ No newline at end of file
+}
+TEST(JournalModificationCreatorTests, testModificationById) {
+    AccountLibrary accounts(2024);
+    JournalModificationCreator modificationCreator(&accounts, Date("03/15/2024"), "Buy supplies");
+    accounts.addAccount("Cash", AccountType::Asset, 1000);
+    accounts.addAccount("Supplies", AccountType::Asset, 0);
+
+    AccountId supplies = accounts.getAccountId("supplies");
+    auto modification = modificationCreator.getJournalModification(ValueType::debit, supplies, Money::parse("12.50"));
+
+    EXPECT_EQ(modification.get().first, Money::parse("12.50"));
+    EXPECT_EQ(modification.get().second, ValueType::debit);
+    EXPECT_EQ(modification.getDescription(), "Buy supplies");
+    EXPECT_EQ(modification.getDate(), Date("03/15/2024"));
+    EXPECT_EQ(modification.getAffectedAccount(), &accounts.getAccount("Supplies"));
+
+    EXPECT_THROW({
+        modificationCreator.getJournalModification(ValueType::credit, 99, 10);
+    }, std::out_of_range);
+}
+
+TEST(JournalModificationCreatorTests, testTryGetReportsColumn) {
+    AccountLibrary accounts(2024);
+    JournalModificationCreator modificationCreator(&accounts, Date("03/15/2024"), "Buy supplies");
+    accounts.addAccount("Supplies", AccountType::Asset, 0);
+
+    ModificationParse parse;
+    auto modification = modificationCreator.tryGetJournalModification("dr supplies, 12.5", parse);
+    ASSERT_TRUE(modification.has_value());
+    EXPECT_TRUE(parse.ok());
+    EXPECT_EQ(modification->getAffectedAccount(), &accounts.getAccount("Supplies"));
+    EXPECT_EQ(modification->get().first, Money::parse("12.50"));
+
+    EXPECT_FALSE(modificationCreator.tryGetJournalModification("dr   Land, 12", parse).has_value());
+    EXPECT_EQ(parse.error, ModificationError::UnknownAccount);
+    EXPECT_EQ(parse.column, 5);
+
+    EXPECT_FALSE(modificationCreator.tryGetJournalModification("dr Supplies, 1x", parse).has_value());
+    EXPECT_EQ(parse.error, ModificationError::TrailingCharacters);
+    EXPECT_EQ(parse.column, 14);
+
+    try {
+        modificationCreator.getJournalModification("cr Supplies 4");
+        FAIL() << "Expected invalid_argument";
+    } catch(const invalid_argument& error) {
+        EXPECT_THAT(error.what(), ::testing::HasSubstr("column 14"));
+    }
+}
@@ -33,4 +33,62 @@ TEST(JournalTests, testAddEntry) {
     ASSERT_EQ(journal.getEntries().front().getModifications().size(), 2);
     EXPECT_EQ(journal.getEntries().front().getModifications().front().getAffectedAccount()->getName(), "Cash");
     EXPECT_EQ(journal.getEntries().front().getModifications().back().getAffectedAccount()->getName(), "Accounts Receivable");
-}
\ No newline at end of file
+}
+TEST(JournalTests, testAccepts) {
+    Journal journal(2024);
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", AccountType::Asset, 1000);
+    accounts.addAccount("Accounts Receivable", AccountType::Asset, 500);
+
+    JournalEntry nextYear(Date("01/01/2025"), "Collect $500 from Accounts Receivable");
+    nextYear.addModification(JournalModification(500, ValueType::debit, nextYear.getDate(), nextYear.getDescription(), &accounts.getAccount("Cash")));
+    nextYear.addModification(JournalModification(500, ValueType::credit, nextYear.getDate(), nextYear.getDescription(), &accounts.getAccount("Accounts Receivable")));
+
+    EXPECT_FALSE(journal.accepts(nextYear));
+    EXPECT_FALSE(journal.journalize(nextYear));
+
+    JournalEntry entry(Date("12/31/2024"), "Collect $500 from Accounts Receivable");
+    entry.addModification(JournalModification(500, ValueType::debit, entry.getDate(), entry.getDescription(), &accounts.getAccount("Cash")));
+    entry.addModification(JournalModification(500, ValueType::credit, entry.getDate(), entry.getDescription(), &accounts.getAccount("Accounts Receivable")));
+
+    ASSERT_TRUE(journal.accepts(entry));
+    JournalEntry& stored = journal.append(entry);
+    EXPECT_EQ(&stored, &journal.getEntries().back());
+    EXPECT_EQ(journal.getEntries().size(), 1);
+}
+
+TEST(JournalTests, testEntriesReferenceContiguousLines) {
+    Journal journal(2024);
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", AccountType::Asset, 1000);
+    accounts.addAccount("Accounts Receivable", AccountType::Asset, 500);
+
+    for(DateUnit day = 1; day <= 3; ++day) {
+        JournalEntry entry(Date(2024, 1, day), "Collect from Accounts Receivable");
+        entry.addModification(JournalModification(day, ValueType::debit, entry.getDate(), entry.getSharedDescription(), &accounts.getAccount("Cash")));
+        entry.addModification(JournalModification(day, ValueType::credit, entry.getDate(), entry.getSharedDescription(), &accounts.getAccount("Accounts Receivable")));
+        ASSERT_TRUE(journal.journalize(std::move(entry)));
+    }
+
+    //Consecutive entries occupy consecutive runs of the journal's line arena
+    EXPECT_EQ(journal.getLines().size(), 6);
+    const JournalModification* previousEnd = nullptr;
+    for(const JournalEntry& entry : journal.getEntries()) {
+        EXPECT_TRUE(entry.isJournalized());
+        if(previousEnd) {
+            EXPECT_EQ(&entry.getModifications().front(), previousEnd);
+        }
+        previousEnd = entry.getModifications().data() + entry.getModifications().size();
+    }
+
+    EXPECT_THROW({
+        journal.getEntries().front().addModification(JournalModification(1, ValueType::credit, Date(2024, 1, 1), "Collect from Accounts Receivable", &accounts.getAccount("Cash")));
+    }, std::invalid_argument);
+
+    //A copy owns its lines again and can be extended
+    JournalEntry copy = journal.getEntries().front();
+    EXPECT_FALSE(copy.isJournalized());
+    copy.addModification(JournalModification(1, ValueType::credit, Date(2024, 1, 1), "Collect from Accounts Receivable", &accounts.getAccount("Cash")));
+    EXPECT_EQ(copy.getModifications().size(), 3);
+    EXPECT_EQ(journal.getEntries().front().getModifications().size(), 2);
+}
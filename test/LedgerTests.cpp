@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/Ledger.h"
+#include "TestEntries.h"
+
+#include <filesystem>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+static void buildChart(AccountLibrary& accounts) {
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Equipment", Asset, 500);
+    accounts.linkAccount("Equipment", "Accumulated Depreciation", ContraAsset, 0);
+    accounts.addAccount("Retained Earnings", StockholdersEquity, 1500);
+    accounts.addAccount("Sales Revenue", Revenue);
+    accounts.addAccount("Depreciation Expense", Expense);
+    accounts.addAccount("Dividends", Dividends);
+    accounts.addAlias("Retained Earnings", "RE");
+    accounts.addAlias("Accumulated Depreciation", "AD");
+}
+
+TEST(LedgerTests, testRollover) {
+    Ledger ledger(2024);
+    buildChart(ledger.getCurrentAccountLibrary());
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 3, 1), 400, "Cash", "Sales Revenue")));
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 12, 31), 100, "Depreciation Expense", "AD")));
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 12, 31), 50, "Dividends", "Cash")));
+
+    ledger.rollover();
+    EXPECT_EQ(ledger.getLastYear(), 2025);
+    EXPECT_TRUE(ledger.isOpen(2024));
+    AccountLibrary& next = ledger.getAccountLibrary(2025);
+    EXPECT_EQ(next.getYear(), 2025);
+    EXPECT_EQ(next.getAccountCount(), ledger.getAccountLibrary(2024).getAccountCount());
+
+    //Real accounts carry their ending balance, nominal accounts start over, income went to retained earnings
+    EXPECT_EQ(next.getAccount("Cash").getBeginningBalance(), 1350);
+    EXPECT_EQ(next.getAccount("AD").getBeginningBalance(), 100);
+    EXPECT_EQ(next.getAccount("RE").getBeginningBalance(), 1500 + 400 - 100 - 50);
+    EXPECT_EQ(next.getAccount("Sales Revenue").getBeginningBalance(), 0);
+    EXPECT_EQ(next.getAccount("Dividends").getBeginningBalance(), 0);
+    EXPECT_EQ(ledger.getAccountLibrary(2024).getAccount("Sales Revenue").getBalance(), 0);
+
+    //Ids, links and aliases mean the same in both years
+    for(AccountId id = 0; id < next.getAccountCount(); ++id) {
+        EXPECT_EQ(next.getAccount(id).getName(), ledger.getAccountLibrary(2024).getAccount(id).getName());
+        EXPECT_EQ(next.getLinkedId(id), ledger.getAccountLibrary(2024).getLinkedId(id));
+    }
+    EXPECT_EQ(next.findLinked("Equipment"), &next.getAccount("AD"));
+
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2025), Date(2025, 1, 5), 200, "Cash", "Sales Revenue")));
+    EXPECT_EQ(next.getAccount("Cash").getBalance(), 1550);
+    EXPECT_TRUE(ledger.getProgram(2025).getTrialBalance().isBalanced());
+}
+
+TEST(LedgerTests, testPriorYearAdjustmentCarriesForward) {
+    Ledger ledger(2024);
+    buildChart(ledger.getCurrentAccountLibrary());
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 3, 1), 400, "Cash", "Sales Revenue")));
+    ledger.rollover();
+    ledger.rollover();
+    ASSERT_EQ(ledger.getLastYear(), 2026);
+
+    //A late 2024 sale moves cash in 2024 and the opening cash of both later years, its income reaches them at closeYear
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 12, 20), 75, "Cash", "Sales Revenue")));
+    EXPECT_EQ(ledger.getAccountLibrary(2025).getAccount("Cash").getBeginningBalance(), 1475);
+    EXPECT_EQ(ledger.getAccountLibrary(2026).getAccount("Cash").getBeginningBalance(), 1475);
+    EXPECT_EQ(ledger.getAccountLibrary(2026).getAccount("Cash").getBalanceAsOf(Date(2026, 6, 1)), 1475);
+    EXPECT_EQ(ledger.getAccountLibrary(2025).getAccount("Cash").getRecords().getMonthRecords(7).getBeginningBalance(), 1475);
+    EXPECT_FALSE(ledger.getProgram(2026).getTrialBalance().isBalanced());
+
+    ledger.closeYear(2024);
+    EXPECT_FALSE(ledger.isOpen(2024));
+    EXPECT_EQ(ledger.getAccountLibrary(2024).getAccount("Sales Revenue").getBalance(), 0);
+    EXPECT_EQ(ledger.getAccountLibrary(2026).getAccount("RE").getBeginningBalance(), 1500 + 475);
+    EXPECT_TRUE(ledger.getProgram(2026).getTrialBalance().isBalanced());
+    EXPECT_EQ(ledger.getProgram(2026).getStatements().getTotal(StatementCategory::Assets), 1975);
+
+    EXPECT_THROW(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 12, 21), 5, "Cash", "Sales Revenue")), invalid_argument);
+}
+
+TEST(LedgerTests, testRejectedClosingEntryStopsRollover) {
+    Ledger ledger(2024);
+    buildChart(ledger.getCurrentAccountLibrary());
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 3, 1), 400, "Cash", "Sales Revenue")));
+
+    //A compacted December takes no 12/31 closing entry, so the year cannot roll over
+    string directory = ::testing::TempDir() + "LedgerTests_rejected";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    ColdStore cold(&ledger.getAccountLibrary(2024), directory);
+    ledger.getProgram(2024).setColdStore(&cold);
+    ledger.getProgram(2024).compactThrough(12);
+
+    EXPECT_THROW(ledger.rollover(), invalid_argument);
+    EXPECT_EQ(ledger.getLastYear(), 2024);
+    EXPECT_EQ(ledger.getAccountLibrary(2024).getAccount("Sales Revenue").getBalance(), 400);
+}
+
+TEST(LedgerTests, testCloseAndCompact) {
+    Ledger ledger(2024);
+    buildChart(ledger.getCurrentAccountLibrary());
+    ASSERT_TRUE(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2024), Date(2024, 3, 1), 400, "Cash", "Sales Revenue")));
+
+    EXPECT_THROW(ledger.closeYear(2024), invalid_argument);
+    ledger.rollover();
+    ledger.rollover();
+    EXPECT_THROW(ledger.closeYear(2025), invalid_argument);
+    EXPECT_THROW(ledger.compactYear(2024), invalid_argument);
+
+    AccountId cash = ledger.getAccountLibrary(2024).getAccountId("Cash");
+    ledger.closeYear(2024);
+    ledger.compactYear(2024);
+    EXPECT_TRUE(ledger.isCompacted(2024));
+    EXPECT_EQ(ledger.getEndingBalance(cash, 2024), 1400);
+    EXPECT_EQ(ledger.getEndingBalance(cash, 2025), 1400);
+    EXPECT_THROW(ledger.getProgram(2024), invalid_argument);
+
+    ledger.closeYear(2025);
+    EXPECT_THROW(ledger.getEndingBalance(cash, 2027), invalid_argument);
+    EXPECT_THROW(ledger.postEntry(makeEntry(ledger.getAccountLibrary(2025), Date(2025, 1, 1), 1, "Cash", "Sales Revenue")), invalid_argument);
+}
+
+TEST(LedgerTests, testRejectsForeignAccounts) {
+    Ledger ledger(2024);
+    buildChart(ledger.getCurrentAccountLibrary());
+    ledger.rollover();
+
+    //A 2024 entry built on the 2025 chart
+    AccountLibrary& next = ledger.getAccountLibrary(2025);
+    Date day(2024, 5, 1);
+    EXPECT_THROW(ledger.postEntry(makeEntry(next, day, 10, "Cash", "Sales Revenue", "Wrong chart")), invalid_argument);
+
+    //Real accounts added to an earlier year after rollover have nowhere to carry
+    ledger.getAccountLibrary(2024).addAccount("Petty Cash", Asset, 0);
+    EXPECT_THROW(ledger.postEntry(makeEntry(ledger.getAccountLibrary(day.getYear()), day, 10, "Petty Cash", "Cash")), invalid_argument);
+    EXPECT_THROW(ledger.getProgram(2023), invalid_argument);
+}
@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/LineArena.h"
+#include "../header/AssetAccount.h"
+
+#include <vector>
+using std::vector;
+
+TEST(LineArenaTests, testStoreIsContiguousAndStable) {
+    LineArena arena;
+    AssetAccount cash("Cash", 2024, 0);
+    vector<JournalModification> lines;
+    for(int i = 0; i < 3; ++i) lines.push_back(JournalModification(i + 1, ValueType::debit, Date("01/01/2024"), "Deposit", &cash));
+
+    span<JournalModification> first = arena.store(span<const JournalModification>(lines));
+    ASSERT_EQ(first.size(), 3);
+    EXPECT_EQ(first[2].get().first, 3);
+    EXPECT_EQ(arena.size(), 3);
+
+    //Fill well past one chunk, the first run must not move
+    const JournalModification* firstAddress = first.data();
+    for(size_t stored = 0; stored < 2 * LineArena::CHUNK_LINES; stored += lines.size()) {
+        span<JournalModification> run = arena.store(span<const JournalModification>(lines));
+        EXPECT_EQ(&run.back() - &run.front(), 2);
+    }
+    EXPECT_EQ(first.data(), firstAddress);
+    EXPECT_EQ(first[0].get().first, 1);
+    EXPECT_GE(arena.getChunkCount(), 2);
+}
+
+TEST(LineArenaTests, testOversizedRunGetsItsOwnChunk) {
+    LineArena arena;
+    AssetAccount cash("Cash", 2024, 0);
+    vector<JournalModification> small(1, JournalModification(1, ValueType::debit, Date("01/01/2024"), "Deposit", &cash));
+    vector<JournalModification> large(LineArena::CHUNK_LINES + 10, JournalModification(2, ValueType::credit, Date("01/01/2024"), "Deposit", &cash));
+
+    arena.store(span<JournalModification>(small));
+    span<JournalModification> run = arena.store(span<JournalModification>(large));
+
+    EXPECT_EQ(run.size(), LineArena::CHUNK_LINES + 10);
+    EXPECT_EQ(run.back().get().first, 2);
+    EXPECT_EQ(arena.getChunkCount(), 2);
+    EXPECT_EQ(arena.size(), LineArena::CHUNK_LINES + 11);
+}
+
+TEST(LineArenaTests, testReleaseFreesDeadChunks) {
+    LineArena arena;
+    AssetAccount cash("Cash", 2024, 0);
+    vector<JournalModification> lines(LineArena::CHUNK_LINES / 2, JournalModification(1, ValueType::debit, Date("01/01/2024"), "Deposit", &cash));
+
+    //Two runs fill the first chunk, the third starts the second
+    vector<span<const JournalModification>> runs;
+    for(int i = 0; i < 3; ++i) runs.push_back(arena.store(span<const JournalModification>(lines)));
+    ASSERT_EQ(arena.getChunkCount(), 2);
+
+    //Half of a chunk released keeps it, all of it frees it without moving lines of other chunks
+    arena.release(span<const span<const JournalModification>>(runs.data(), 1));
+    EXPECT_EQ(arena.getChunkCount(), 2);
+    EXPECT_EQ(arena.size(), LineArena::CHUNK_LINES);
+    const JournalModification* survivor = runs[2].data();
+    arena.release(span<const span<const JournalModification>>(runs.data() + 1, 1));
+    EXPECT_EQ(arena.getChunkCount(), 1);
+    EXPECT_EQ(arena.size(), LineArena::CHUNK_LINES / 2);
+    EXPECT_EQ(runs[2].data(), survivor);
+    EXPECT_EQ(survivor->get().first, 1);
+
+    //The last chunk is emptied rather than freed and keeps taking lines
+    arena.release(span<const span<const JournalModification>>(runs.data() + 2, 1));
+    EXPECT_EQ(arena.size(), 0);
+    EXPECT_EQ(arena.getChunkCount(), 1);
+    span<JournalModification> again = arena.store(span<const JournalModification>(lines));
+    EXPECT_EQ(again.size(), lines.size());
+    EXPECT_EQ(arena.getChunkCount(), 1);
+}
+
+TEST(LineArenaTests, testLiveLinesPinTheirChunks) {
+    LineArena arena;
+    AssetAccount cash("Cash", 2024, 0);
+    vector<JournalModification> lines(2, JournalModification(1, ValueType::debit, Date("01/01/2024"), "Deposit", &cash));
+
+    //Every other run is released, as compacting a journal posted out of date order would, so no chunk empties
+    vector<span<const JournalModification>> released;
+    for(size_t stored = 0; stored < 4 * LineArena::CHUNK_LINES; stored += lines.size()) {
+        span<const JournalModification> run = arena.store(span<const JournalModification>(lines));
+        if(stored % 4 == 0) released.push_back(run);
+    }
+    ASSERT_EQ(arena.getChunkCount(), 4);
+    arena.release(released);
+    EXPECT_EQ(arena.size(), 2 * LineArena::CHUNK_LINES);
+    EXPECT_EQ(arena.getChunkCount(), 4);
+    EXPECT_EQ(arena.getCapacity(), 4 * LineArena::CHUNK_LINES);
+
+    //Whatever the order, only chunks holding a live line survive, plus the last
+    released.clear();
+    for(size_t i = 0; i < 2 * LineArena::CHUNK_LINES; i += lines.size()) {
+        released.push_back(arena.store(span<const JournalModification>(lines)));
+    }
+    arena.release(released);
+    EXPECT_LE(arena.getChunkCount(), arena.size() + 1);
+    EXPECT_EQ(arena.getChunkCount(), 5);
+}
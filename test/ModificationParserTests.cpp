@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/ModificationParser.h"
+#include "AllocationCounter.h"
+
+TEST(ModificationParserTests, testParse) {
+    ModificationParse parse = parseModification("Dr. Accounts Receivable, 150.25");
+    ASSERT_TRUE(parse.ok());
+    EXPECT_EQ(parse.type, ValueType::debit);
+    EXPECT_EQ(parse.account, "Accounts Receivable");
+    EXPECT_EQ(parse.accountColumn, 4);
+    EXPECT_EQ(parse.amount, Money::parse("150.25"));
+
+    parse = parseModification("  cr   Sales  ,  -0.5  ");
+    ASSERT_TRUE(parse.ok());
+    EXPECT_EQ(parse.type, ValueType::credit);
+    EXPECT_EQ(parse.account, "Sales");
+    EXPECT_EQ(parse.amount, -Money::parse("0.5"));
+
+    EXPECT_EQ(parseModification("d cash, 7").amount, 7);
+    EXPECT_EQ(parseModification("d cash, .05").amount, Money::fromMinorUnits(5));
+    EXPECT_EQ(parseModification("d cash, +3.").amount, 3);
+    EXPECT_EQ(parseModification("d cash, 1.2300").amount, Money::parse("1.23"));
+    EXPECT_EQ(parseModification("Debit Cash,92233720368547758.07").amount, Money::fromMinorUnits(9223372036854775807));
+}
+
+TEST(ModificationParserTests, testErrorsCarryColumns) {
+    auto expectError = [](string_view line, ModificationError error, size_t column) {
+        ModificationParse parse = parseModification(line);
+        EXPECT_EQ(parse.error, error) << line;
+        EXPECT_EQ(parse.column, column) << line;
+        EXPECT_FALSE(parse.ok()) << line;
+    };
+    expectError("", ModificationError::MissingValueType, 0);
+    expectError("   ", ModificationError::MissingValueType, 3);
+    expectError("  x Cash, 10", ModificationError::UnknownValueType, 2);
+    expectError("dr", ModificationError::MissingAccount, 2);
+    expectError("dr Cash 10", ModificationError::MissingSeparator, 10);
+    expectError("dr , 10", ModificationError::MissingAccount, 3);
+    expectError("dr Cash,   ", ModificationError::MissingAmount, 11);
+    expectError("dr Cash, a", ModificationError::InvalidAmount, 9);
+    expectError("dr Cash, -", ModificationError::InvalidAmount, 10);
+    expectError("dr Cash, .", ModificationError::InvalidAmount, 9);
+    expectError("dr Cash, 1.234", ModificationError::ExcessPrecision, 13);
+    expectError("dr Cash, 12 dollars", ModificationError::TrailingCharacters, 11);
+    expectError("dr Cash, 99999999999999999999", ModificationError::AmountOutOfRange, 9);
+    expectError("dr Cash, 92233720368547758.08", ModificationError::AmountOutOfRange, 9);
+    EXPECT_STREQ(parseModification("dr Cash 10").describe(), "Missing comma between account and amount");
+}
+
+TEST(ModificationParserTests, testParseDoesNotAllocate) {
+    size_t before = AllocationCounter::getAllocations();
+    for(int i = 0; i < 100; ++i) {
+        parseModification("Dr. A fairly long account name that would not fit a short string, 1234567.89");
+        parseModification("cr Cash, bad amount");
+    }
+    EXPECT_EQ(AllocationCounter::getAllocations(), before);
+}
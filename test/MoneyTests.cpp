@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/Money.h"
+
+#include <sstream>
+using std::ostringstream;
+
+#include <stdexcept>
+using std::invalid_argument;
+
+#include <limits>
+
+TEST(MoneyTests, testWholeUnitConstructor) {
+    Money amount(150);
+    EXPECT_EQ(amount.getMinorUnits(), 150 * Money::SCALE);
+    EXPECT_EQ(amount, 150);
+    EXPECT_EQ(Money(), 0);
+}
+
+TEST(MoneyTests, testArithmetic) {
+    Money a = Money::parse("0.1"), b = Money::parse("0.2"), c = Money::parse("0.3");
+    EXPECT_EQ(a + b, c);
+    EXPECT_EQ(c - b - a, 0);
+    EXPECT_EQ(-a, Money::parse("-0.10"));
+    EXPECT_LT(a, b);
+    EXPECT_GT(c, b);
+
+    Money total;
+    for(unsigned i = 0; i < 1000000; ++i) total += a;
+    EXPECT_EQ(total, 100000);
+}
+
+TEST(MoneyTests, testParse) {
+    EXPECT_EQ(Money::parse("150"), 150);
+    EXPECT_EQ(Money::parse(" 150.5 "), Money::fromMinorUnits(15050));
+    EXPECT_EQ(Money::parse("600.000000"), 600);
+    EXPECT_EQ(Money::parse(".25"), Money::fromMinorUnits(25));
+    EXPECT_EQ(Money::parse("-12.34"), Money::fromMinorUnits(-1234));
+
+    EXPECT_THROW(Money::parse(""), invalid_argument);
+    EXPECT_THROW(Money::parse("a"), invalid_argument);
+    EXPECT_THROW(Money::parse("12a"), invalid_argument);
+    EXPECT_THROW(Money::parse("1.005"), invalid_argument);
+    EXPECT_THROW(Money::parse("99999999999999999999"), invalid_argument);
+}
+
+TEST(MoneyTests, testParseRangeEdge) {
+    EXPECT_EQ(Money::parse("92233720368547758.07"), Money::fromMinorUnits(std::numeric_limits<int64_t>::max()));
+    EXPECT_EQ(Money::parse("-92233720368547758.07"), Money::fromMinorUnits(-std::numeric_limits<int64_t>::max()));
+    EXPECT_THROW(Money::parse("92233720368547758.08"), invalid_argument);
+    EXPECT_THROW(Money::parse("92233720368547758.09"), invalid_argument);
+    EXPECT_THROW(Money::parse("92233720368547759"), invalid_argument);
+}
+
+TEST(MoneyTests, testTryParse) {
+    MoneyParse parse = Money::tryParse(" -3.5 ");
+    ASSERT_TRUE(parse.ok());
+    EXPECT_EQ(parse.amount, Money::fromMinorUnits(-350));
+
+    auto expectError = [](string_view text, MoneyParseError error, size_t column) {
+        MoneyParse parse = Money::tryParse(text);
+        EXPECT_EQ(parse.error, error) << text;
+        EXPECT_EQ(parse.column, column) << text;
+    };
+    expectError("", MoneyParseError::InvalidAmount, 0);
+    expectError("  -x", MoneyParseError::InvalidAmount, 3);
+    expectError(" .", MoneyParseError::InvalidAmount, 1);
+    expectError("1.001", MoneyParseError::ExcessPrecision, 4);
+    expectError("12 dollars", MoneyParseError::TrailingCharacters, 2);
+    expectError(" 92233720368547758.08", MoneyParseError::OutOfRange, 1);
+}
+
+TEST(MoneyTests, testStringForm) {
+    EXPECT_EQ(Money(1000000).stringForm(), "1000000.00");
+    EXPECT_EQ(Money::fromMinorUnits(5).stringForm(), "0.05");
+    EXPECT_EQ(Money::fromMinorUnits(-1234).stringForm(), "-12.34");
+
+    ostringstream out;
+    out << Money::parse("42.1");
+    EXPECT_EQ(out.str(), "42.10");
+}
+
+TEST(MoneyTests, testFromDouble) {
+    EXPECT_EQ(Money::fromDouble(0.1 + 0.2), Money::parse("0.3"));
+    EXPECT_EQ(Money::fromDouble(-2.005), Money::parse("-2.01"));
+}
@@ -16,4 +16,14 @@ TEST(periodTests, testProperRecording) {
     EXPECT_EQ(p.getEndDate(), endDate);
     EXPECT_NE(p.getStartDate(), endDate);
     EXPECT_NE(p.getEndDate(), startDate);
-}
\ No newline at end of file
+}
+
+TEST(periodTests, testContains) {
+    Period p(Date("02/01/2001"), Date("03/31/2001"));
+
+    EXPECT_TRUE(p.contains(Date("02/01/2001")));
+    EXPECT_TRUE(p.contains(Date("03/15/2001")));
+    EXPECT_TRUE(p.contains(Date("03/31/2001")));
+    EXPECT_FALSE(p.contains(Date("01/31/2001")));
+    EXPECT_FALSE(p.contains(Date("04/01/2001")));
+}
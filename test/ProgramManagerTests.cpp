@@ -1051,7 +1051,7 @@ TEST(ProgramManagerTests, programIntegrationTest) {
     }
 
     {
-        Date day = Date("06/31/2024");
+        Date day = Date("06/30/2024");
         string description = "Record Supplies Expense for June";
         JournalEntryCreator entryCreator(day, description);
         JournalModificationCreator modificationCreator(&program.getAccountLibrary(), day, description);
@@ -1098,7 +1098,7 @@ TEST(ProgramManagerTests, programIntegrationTest) {
     }
 
     {
-        Date day = Date("06/31/2024");
+        Date day = Date("06/30/2024");
         string description = "Record Depreciation Expense for June";
         JournalEntryCreator entryCreator(day, description);
         JournalModificationCreator modificationCreator(&program.getAccountLibrary(), day, description);
@@ -1929,7 +1929,7 @@ TEST(ProgramManagerTests, programIntegrationTest) {
     }
 
     {
-        Date day = Date("09/31/2024");
+        Date day = Date("09/30/2024");
         string description = "Record Supplies Expense for September";
         JournalEntryCreator entryCreator(day, description);
         JournalModificationCreator modificationCreator(&program.getAccountLibrary(), day, description);
@@ -1993,7 +1993,7 @@ TEST(ProgramManagerTests, programIntegrationTest) {
     }
 
     {
-        Date day = Date("09/31/2024");
+        Date day = Date("09/30/2024");
         string description = "Record Depreciation Expense for September";
         JournalEntryCreator entryCreator(day, description);
         JournalModificationCreator modificationCreator(&program.getAccountLibrary(), day, description);
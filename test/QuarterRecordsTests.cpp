@@ -156,16 +156,34 @@ TEST(QuarterRecordsTests, testAddEntryThrow) {
         EXPECT_EQ(q2.getMonthRecords()[i].getEntries().size(), 0);
     }
 
-    JournalModification modification3(100, ValueType::credit, Date("03/01/2001"), "Pay $100 in cash", &cash);
+}
+
+TEST(QuarterRecordsTests, testAddEntryOutOfOrder) {
+    QuarterRecords q1(2001, 1, ValueType::debit, 1000); //Start with $1000 cash
+    AssetAccount cash("Cash", 2001, 1000);
+    JournalModification modification1(100, ValueType::credit, Date("03/01/2001"), "Pay $100 in cash", &cash);
+    JournalModification modification2(200, ValueType::credit, Date("02/01/2001"), "Pay $200 in cash", &cash);
+    JournalModification modification3(50, ValueType::debit, Date("01/01/2001"), "Earn $50 in cash", &cash);
+    JournalModification modification4(10, ValueType::debit, Date("02/01/2001"), "Earn $10 in cash", &cash);
+    q1.addEntry(&modification1);
+    q1.addEntry(&modification2);
     q1.addEntry(&modification3);
-    EXPECT_THROW({
-        JournalModification test(100, ValueType::credit, Date("02/01/2001"), "Pay $100 in cash", &cash);
-        q1.addEntry(&test);
-    }, invalid_argument);
-    EXPECT_THROW({
-        JournalModification test(100, ValueType::credit, Date("01/01/2001"), "Pay $100 in cash", &cash);
-        q1.addEntry(&test);
-    }, invalid_argument);
+    q1.addEntry(&modification4);
+
+    EXPECT_EQ(q1.getBeginningBalance(), 1000);
+    EXPECT_EQ(q1.getEndingBalance(), 760);
+    EXPECT_EQ(q1.getMonthRecords()[0].getBeginningBalance(), 1000);
+    EXPECT_EQ(q1.getMonthRecords()[0].getEndingBalance(), 1050);
+    EXPECT_EQ(q1.getMonthRecords()[1].getBeginningBalance(), 1050);
+    EXPECT_EQ(q1.getMonthRecords()[1].getEndingBalance(), 860);
+    EXPECT_EQ(q1.getMonthRecords()[2].getBeginningBalance(), 860);
+    EXPECT_EQ(q1.getMonthRecords()[2].getEndingBalance(), 760);
+
+    vector<JournalModification*> expected = {&modification3, &modification2, &modification4, &modification1};
+    EXPECT_EQ(vector<JournalModification*>(q1.getEntries().begin(), q1.getEntries().end()), expected);
+    ASSERT_EQ(q1.getMonthRecords()[1].getEntries().size(), 2);
+    EXPECT_EQ(q1.getMonthRecords()[1].getEntries()[0], &modification2);
+    EXPECT_EQ(q1.getMonthRecords()[1].getEntries()[1], &modification4);
 }
 
 TEST(QuarterRecordsTests, testGetEntriesAndMonthEntries) {
@@ -186,7 +204,7 @@ TEST(QuarterRecordsTests, testGetEntriesAndMonthEntries) {
     EXPECT_EQ(q2.getMonthRecords()[1].getEntries()[0], &mayModification1);
     EXPECT_EQ(q2.getMonthRecords()[1].getEntries()[1], &mayModification2);
     EXPECT_EQ(q2.getMonthRecords()[2].getEntries()[0], &juneModification1);
-    EXPECT_EQ(q2.getEntries(), expected);
+    EXPECT_EQ(vector<JournalModification*>(q2.getEntries().begin(), q2.getEntries().end()), expected);
 
     EXPECT_EQ(q2.getMonthRecords()[0].getBeginningBalance(), 1000);
     EXPECT_EQ(q2.getMonthRecords()[0].getEndingBalance(), 900);
@@ -0,0 +1,205 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/Snapshot.h"
+#include "../header/ProgramManager.h"
+#include "TestEntries.h"
+
+#include <cstdio>
+
+#include <fstream>
+
+#include <stdexcept>
+using std::invalid_argument;
+
+#include <string>
+using std::string;
+
+#include <vector>
+using std::vector;
+
+static string snapshotPath(const string& name) {
+    string path = ::testing::TempDir() + "SnapshotTests_" + name + ".snap";
+    std::remove(path.c_str());
+    return path;
+}
+
+static void buildProgram(ProgramManager& program) {
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Equipment", Asset, 3000);
+    accounts.linkAccount("Equipment", "Accumulated Depreciation", ContraAsset, 200);
+    accounts.addAccount("Sales Revenue", Revenue, 0);
+    accounts.linkAccount("Sales Revenue", "Sales Returns", ContraRevenue, 0);
+    accounts.addAccount("Depreciation Expense", Expense, 0);
+    accounts.addAlias("Cash", "Checking");
+    accounts.addAlias("Accumulated Depreciation", "ADE");
+    accounts.addAlias("Sales Revenue", "Sales");
+    accounts.removeAlias("Sales Revenue"); //Only the alias still names the account
+
+    for(unsigned i = 0; i < 40; ++i) {
+        Date day(2024, i % 12 + 1, i % 28 + 1);
+        JournalEntry entry(day, i % 2 ? "Cash sale" : "Depreciation " + std::to_string(i));
+        if(i % 2) {
+            entry.addModification(JournalModification(Money::fromMinorUnits(1000 + i), ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount("Checking")));
+            entry.addModification(JournalModification(100, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount("Sales Returns")));
+            entry.addModification(JournalModification(Money::fromMinorUnits(1000 + i), ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount("Sales")));
+            entry.addModification(JournalModification(100, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount("Cash")));
+        } else {
+            entry.addModification(JournalModification(10, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount("Depreciation Expense")));
+            entry.addModification(JournalModification(10, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount("ADE")));
+        }
+        program.postEntry(std::move(entry));
+    }
+}
+
+TEST(SnapshotTests, testRoundTrip) {
+    string path = snapshotPath("roundtrip");
+    ProgramManager original(2024);
+    buildProgram(original);
+    Snapshot::write(path, original);
+
+    Snapshot snapshot(path);
+    EXPECT_EQ(snapshot.getYear(), 2024);
+    EXPECT_EQ(snapshot.getAccountCount(), 6);
+    EXPECT_EQ(snapshot.getAccountName(2), "Accumulated Depreciation");
+    EXPECT_EQ(snapshot.getAccountType(2), ContraAsset);
+    EXPECT_EQ(snapshot.getEntryCount(), original.getJournal().getEntries().size());
+    EXPECT_EQ(snapshot.getLineCount(), original.getJournal().getLines().size());
+    EXPECT_EQ(snapshot.getEntryDescription(3), "Cash sale");
+    EXPECT_EQ(snapshot.getLineDescription(snapshot.getEntryLineStarts()[4] + 1), "Depreciation 4");
+    EXPECT_EQ(snapshot.getEntryDate(5), original.getJournal().getEntries()[5].getDate());
+
+    //Columns can be scanned in place without restoring anything
+    Money cashDebits;
+    for(size_t line = 0; line < snapshot.getLineCount(); ++line) {
+        if(snapshot.getLineAccounts()[line] == 0 and snapshot.getLineTypes()[line] == ValueType::debit) cashDebits += Money::fromMinorUnits(snapshot.getLineAmounts()[line]);
+    }
+    EXPECT_EQ(cashDebits, original.getAccountLibrary().getAccount("Cash").getBalance() - 1000 + 100 * 20);
+
+    ProgramManager restored(2024);
+    EXPECT_EQ(snapshot.restore(restored), 40);
+    const AccountLibrary& expected = original.getAccountLibrary();
+    const AccountLibrary& actual = restored.getAccountLibrary();
+    ASSERT_EQ(actual.getAccountCount(), expected.getAccountCount());
+    for(AccountId id = 0; id < expected.getAccountCount(); ++id) {
+        EXPECT_EQ(actual.getAccount(id), expected.getAccount(id));
+        EXPECT_EQ(actual.getLinkedId(id), expected.getLinkedId(id));
+        ASSERT_EQ(actual.getAccount(id).getEntries().size(), expected.getAccount(id).getEntries().size());
+        for(size_t i = 0; i < expected.getAccount(id).getEntries().size(); ++i) {
+            EXPECT_EQ(actual.getAccount(id).getEntries()[i]->getDescription(), expected.getAccount(id).getEntries()[i]->getDescription());
+        }
+    }
+    EXPECT_EQ(actual.getAccountId("checking"), 0);
+    EXPECT_EQ(actual.getAccountId("ADE"), 2);
+    EXPECT_EQ(actual.getAccountId("Sales"), 3);
+    EXPECT_THROW(actual.getAccountId("Sales Revenue"), invalid_argument);
+    EXPECT_EQ(restored.getJournal().getEntries().size(), 40);
+}
+
+TEST(SnapshotTests, testRestoreRebuildsRecordsAndViews) {
+    string path = snapshotPath("records");
+    ProgramManager original(2024);
+    buildProgram(original);
+    Snapshot::write(path, original);
+    ProgramManager restored(2024);
+    Snapshot(path).restore(restored);
+
+    const AccountLibrary& expected = original.getAccountLibrary();
+    const AccountLibrary& actual = restored.getAccountLibrary();
+    for(AccountId id = 0; id < expected.getAccountCount(); ++id) {
+        const Account& before = expected.getAccount(id);
+        const Account& after = actual.getAccount(id);
+        for(DateUnit month = 1; month <= 12; ++month) {
+            EXPECT_EQ(after.getRecords().getMonthRecords(month).getEndingBalance(), before.getRecords().getMonthRecords(month).getEndingBalance());
+            ASSERT_EQ(after.getMonthsEntries(month).size(), before.getMonthsEntries(month).size());
+            for(size_t i = 0; i < before.getMonthsEntries(month).size(); ++i) {
+                EXPECT_EQ(after.getMonthsEntries(month)[i]->get(), before.getMonthsEntries(month)[i]->get());
+                EXPECT_EQ(after.getMonthsEntries(month)[i]->getDate(), before.getMonthsEntries(month)[i]->getDate());
+            }
+        }
+        for(Date day : {Date(2024, 1, 1), Date(2024, 3, 15), Date(2024, 12, 31)}) EXPECT_EQ(after.getBalanceAsOf(day), before.getBalanceAsOf(day));
+        EXPECT_EQ(restored.getTrialBalance().getDebitBalance(id), original.getTrialBalance().getDebitBalance(id));
+        EXPECT_EQ(restored.getTrialBalance().getCreditBalance(id), original.getTrialBalance().getCreditBalance(id));
+    }
+    EXPECT_EQ(restored.getTrialBalance().getTotals().debits, original.getTrialBalance().getTotals().debits);
+    EXPECT_EQ(restored.getClosingEngine().getNetIncome(), original.getClosingEngine().getNetIncome());
+
+    //The restored journal keeps taking entries, and its views follow them as the original's do
+    Money netIncome = original.getClosingEngine().getNetIncome();
+    for(ProgramManager* program : {&original, &restored}) post(*program, Date(2024, 6, 1), 500, "Cash", "Sales", "Cash sale");
+    EXPECT_EQ(restored.getClosingEngine().getNetIncome(), netIncome + 500);
+    EXPECT_EQ(restored.getTrialBalance().getTotals().debits, original.getTrialBalance().getTotals().debits);
+    EXPECT_EQ(restored.getTrialBalance().getTotals().credits, original.getTrialBalance().getTotals().credits);
+}
+
+TEST(SnapshotTests, testEmptyProgram) {
+    string path = snapshotPath("empty");
+    ProgramManager original(2025);
+    Snapshot::write(path, original);
+    Snapshot snapshot(path);
+    EXPECT_EQ(snapshot.getAccountCount(), 0);
+    EXPECT_EQ(snapshot.getEntryCount(), 0);
+    ProgramManager restored(2025);
+    EXPECT_EQ(snapshot.restore(restored), 0);
+}
+
+TEST(SnapshotTests, testDamagedFileRejected) {
+    string path = snapshotPath("damaged");
+    ProgramManager original(2024);
+    buildProgram(original);
+    Snapshot::write(path, original);
+
+    std::ifstream in(path, std::ios::binary);
+    string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+
+    Snapshot{path}.verify();
+    string corrupt = contents;
+    corrupt[corrupt.size() / 2] ^= 0x20;
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << corrupt;
+    //Opening only reads the header, the checksum is left to verify
+    Snapshot damaged(path);
+    EXPECT_THROW(damaged.verify(), invalid_argument);
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << contents.substr(0, contents.size() - 3);
+    EXPECT_THROW(Snapshot{path}, invalid_argument);
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "Not a snapshot, just some text long enough for a header";
+    EXPECT_THROW(Snapshot{path}, invalid_argument);
+}
+
+TEST(SnapshotTests, testLineOfNeitherSideRejected) {
+    //A side byte other than debit or credit, as a damaged file that was never verified would hold
+    string path = snapshotPath("side");
+    ProgramManager original(2024);
+    original.getAccountLibrary().addAccount("Cash", Asset, 0);
+    original.getAccountLibrary().addAccount("Sales Revenue", Revenue, 0);
+    JournalEntry entry(Date("01/01/2024"), "Damaged side");
+    entry.addModification(JournalModification(5, ValueType::debit, entry.getDate(), entry.getSharedDescription(), &original.getAccountLibrary().getAccount("Cash")));
+    entry.addModification(JournalModification(5, ValueType(2), entry.getDate(), entry.getSharedDescription(), &original.getAccountLibrary().getAccount("Sales Revenue")));
+    ASSERT_TRUE(original.postEntry(std::move(entry)));
+    Snapshot::write(path, original);
+
+    Snapshot snapshot(path);
+    ASSERT_EQ(snapshot.getLineTypes()[1], 2);
+    ProgramManager restored(2024);
+    EXPECT_THROW(snapshot.restore(restored), invalid_argument);
+}
+
+TEST(SnapshotTests, testRestoreRequiresEmptyProgramOfSameYear) {
+    string path = snapshotPath("target");
+    ProgramManager original(2024);
+    buildProgram(original);
+    Snapshot::write(path, original);
+    Snapshot snapshot(path);
+
+    ProgramManager otherYear(2023);
+    EXPECT_THROW(snapshot.restore(otherYear), invalid_argument);
+    ProgramManager populated(2024);
+    populated.getAccountLibrary().addAccount("Cash", Asset, 0);
+    EXPECT_THROW(snapshot.restore(populated), invalid_argument);
+}
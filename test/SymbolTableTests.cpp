@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/SymbolTable.h"
+
+#include <string>
+using std::string;
+
+TEST(SymbolTableTests, testIntern) {
+    SymbolTable symbols;
+
+    EXPECT_EQ(symbols.intern("Cash"), 0);
+    EXPECT_EQ(symbols.intern("Accounts Receivable"), 1);
+    EXPECT_EQ(symbols.intern("CASH"), 0);
+    EXPECT_EQ(symbols.intern("accounts receivable"), 1);
+    EXPECT_EQ(symbols.size(), 2);
+
+    //The first spelling seen is the one kept
+    EXPECT_EQ(symbols.getName(0), "Cash");
+    EXPECT_EQ(symbols.getName(1), "Accounts Receivable");
+}
+
+TEST(SymbolTableTests, testFind) {
+    SymbolTable symbols;
+    symbols.intern("Retained Earnings");
+
+    EXPECT_EQ(symbols.find("retained EARNINGS"), 0);
+    EXPECT_EQ(symbols.find("Land"), NO_SYMBOL);
+    EXPECT_EQ(symbols.size(), 1);
+}
+
+TEST(SymbolTableTests, testManyNamesStayValid) {
+    SymbolTable symbols;
+    //Short names use the string's inline buffer, so growth must not move stored strings
+    for(int i = 0; i < 10000; ++i) symbols.intern(string("A").append(std::to_string(i)));
+
+    for(int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(symbols.find(string("a").append(std::to_string(i))), static_cast<SymbolId>(i));
+    }
+}
+
+TEST(SymbolTableTests, testCopy) {
+    SymbolTable original;
+    original.intern("Cash");
+    original.intern("Land");
+
+    SymbolTable copy = original;
+    original = SymbolTable();
+
+    EXPECT_EQ(copy.find("LAND"), 1);
+    EXPECT_EQ(copy.intern("Supplies"), 2);
+    EXPECT_EQ(original.find("Cash"), NO_SYMBOL);
+
+    SymbolTable moved = std::move(copy);
+    EXPECT_EQ(moved.find("supplies"), 2);
+}
@@ -0,0 +1,24 @@
+#ifndef TEST_ENTRIES_H
+#define TEST_ENTRIES_H
+
+#include "gtest/gtest.h"
+
+#include "../header/ProgramManager.h"
+
+#include <string>
+using std::string;
+
+//One balanced two line entry, amount debited to debitName and credited to creditName, both looked up in accounts
+inline JournalEntry makeEntry(AccountLibrary& accounts, const Date& day, Money amount, const string& debitName, const string& creditName, const string& description = "Test") {
+    JournalEntry entry(day, description);
+    entry.addModification(JournalModification(amount, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount(debitName)));
+    entry.addModification(JournalModification(amount, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount(creditName)));
+    return entry;
+}
+
+//makeEntry against program's chart, posted through program. Fails the test when the entry is rejected.
+inline void post(ProgramManager& program, const Date& day, Money amount, const string& debitName, const string& creditName, const string& description = "Test") {
+    ASSERT_TRUE(program.postEntry(makeEntry(program.getAccountLibrary(), day, amount, debitName, creditName, description)));
+}
+
+#endif
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/ThreadPool.h"
+
+#include <stdexcept>
+using std::runtime_error;
+
+TEST(ThreadPoolTests, testThreadCount) {
+    EXPECT_EQ(ThreadPool(1).getThreadCount(), 1);
+    EXPECT_EQ(ThreadPool(4).getThreadCount(), 4);
+    EXPECT_GE(ThreadPool().getThreadCount(), 1);
+}
+
+TEST(ThreadPoolTests, testEveryIndexRunsOnce) {
+    ThreadPool pool(4);
+    //Repeated loops of different sizes reuse the same workers
+    for(size_t count : {0, 1, 2, 3, 100, 10000}) {
+        vector<atomic<unsigned>> calls(count);
+        pool.parallelFor(count, [&](size_t i) { calls[i].fetch_add(1); });
+        for(size_t i = 0; i < count; ++i) EXPECT_EQ(calls[i].load(), 1) << "index " << i << " of " << count;
+    }
+}
+
+TEST(ThreadPoolTests, testSingleThreadRunsInOrder) {
+    ThreadPool pool(1);
+    vector<size_t> order;
+    pool.parallelFor(5, [&](size_t i) { order.push_back(i); });
+    EXPECT_EQ(order, vector<size_t>({0, 1, 2, 3, 4}));
+}
+
+TEST(ThreadPoolTests, testExceptionPropagates) {
+    ThreadPool pool(3);
+    atomic<unsigned> finished{0};
+    EXPECT_THROW({
+        pool.parallelFor(50, [&](size_t i) {
+            if(i == 17) throw runtime_error("task failed");
+            finished.fetch_add(1);
+        });
+    }, runtime_error);
+    //A failing task does not stop the others
+    EXPECT_EQ(finished.load(), 49);
+
+    //The pool stays usable afterwards
+    atomic<unsigned> calls{0};
+    pool.parallelFor(10, [&](size_t) { calls.fetch_add(1); });
+    EXPECT_EQ(calls.load(), 10);
+}
@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using ::testing::_;
+using ::testing::InSequence;
+
+#include "../header/TrialBalance.h"
+#include "../header/ProgramManager.h"
+#include "TestEntries.h"
+
+#include <thread>
+#include <vector>
+using std::vector;
+
+TEST(TrialBalanceTests, testColumns) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    const TrialBalance& trialBalance = program.getTrialBalance();
+    accounts.addAccount("Cash", Asset, 1000);
+    accounts.addAccount("Equipment", Asset, 500);
+    accounts.linkAccount("Equipment", "Accumulated Depreciation", ContraAsset, 100);
+    accounts.addAccount("Accounts Payable", Liability, 400);
+    accounts.addAccount("Common Stock", StockholdersEquity, 1000);
+    accounts.addAccount("Sales Revenue", Revenue);
+    accounts.addAccount("Rent Expense", Expense);
+
+    //Beginning balances of accounts added after the last posting are picked up on the next query, const or not
+    EXPECT_EQ(trialBalance.getTypeTotals(Asset).debits, 1500);
+    EXPECT_EQ(trialBalance.getTypeTotals(ContraAsset).credits, 100);
+    EXPECT_EQ(trialBalance.getTotals().debits, 1500);
+    EXPECT_EQ(trialBalance.getTotals().credits, 1500);
+    EXPECT_TRUE(trialBalance.isBalanced());
+
+    ASSERT_TRUE(program.postEntry(makeEntry(accounts, Date(2024, 2, 1), 300, "Cash", "Sales Revenue")));
+    ASSERT_TRUE(program.postEntry(makeEntry(accounts, Date(2024, 2, 2), 120, "Rent Expense", "Cash")));
+
+    TrialBalanceTotals totals = trialBalance.getTotals();
+    EXPECT_EQ(totals.debits, 1000 + 300 - 120 + 500 + 120);
+    EXPECT_EQ(totals.credits, 100 + 400 + 1000 + 300);
+    EXPECT_TRUE(totals.isBalanced());
+    EXPECT_EQ(trialBalance.getDebitBalance(accounts.getAccountId("Cash")), 1180);
+    EXPECT_EQ(trialBalance.getCreditBalance(accounts.getAccountId("Cash")), 0);
+    EXPECT_EQ(trialBalance.getCreditBalance(accounts.getAccountId("Sales Revenue")), 300);
+    EXPECT_EQ(trialBalance.getTypeTotals(Revenue).credits, 300);
+    EXPECT_EQ(trialBalance.getTypeTotals(Expense).debits, 120);
+}
+
+TEST(TrialBalanceTests, testBalanceChangesColumn) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    TrialBalance& trialBalance = program.getTrialBalance();
+    accounts.addAccount("Cash", Asset, 100);
+    accounts.addAccount("Common Stock", StockholdersEquity, 100);
+    accounts.addAccount("Notes Payable", Liability, 0);
+
+    //An overdrawn asset moves from the debit column to the credit column
+    ASSERT_TRUE(program.postEntry(makeEntry(accounts, Date(2024, 3, 1), 150, "Notes Payable", "Cash")));
+    AccountId cash = accounts.getAccountId("Cash");
+    AccountId notes = accounts.getAccountId("Notes Payable");
+    EXPECT_EQ(trialBalance.getDebitBalance(cash), 0);
+    EXPECT_EQ(trialBalance.getCreditBalance(cash), 50);
+    EXPECT_EQ(trialBalance.getDebitBalance(notes), 150);
+    EXPECT_EQ(trialBalance.getTotals().debits, 150);
+    EXPECT_EQ(trialBalance.getTotals().credits, 150);
+    EXPECT_EQ(trialBalance.getTypeTotals(Asset).credits, 50);
+    EXPECT_EQ(trialBalance.getTypeTotals(Asset).debits, 0);
+}
+
+TEST(TrialBalanceTests, testMatchesAccountsAfterBatch) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 5000);
+    accounts.addAccount("Common Stock", StockholdersEquity, 5000);
+    accounts.addAccount("Sales Revenue", Revenue);
+    accounts.addAccount("Wages Expense", Expense);
+
+    vector<JournalEntry> batch;
+    for(int i = 0; i < 100; ++i) {
+        batch.push_back(makeEntry(accounts, Date(2024, i % 12 + 1, 1), 10 + i, "Cash", "Sales Revenue"));
+        batch.push_back(makeEntry(accounts, Date(2024, i % 12 + 1, 2), 5, "Wages Expense", "Cash"));
+    }
+    ASSERT_EQ(program.postEntries(batch), 200);
+
+    //A trial balance built now from account balances agrees with the one maintained during posting
+    const TrialBalance rebuilt(&accounts);
+    EXPECT_EQ(rebuilt.getTotals().debits, program.getTrialBalance().getTotals().debits);
+    EXPECT_EQ(rebuilt.getTotals().credits, program.getTrialBalance().getTotals().credits);
+    EXPECT_TRUE(program.getTrialBalance().isBalanced());
+    for(AccountId id = 0; id < accounts.getAccountCount(); ++id) {
+        EXPECT_EQ(rebuilt.getDebitBalance(id), program.getTrialBalance().getDebitBalance(id));
+        EXPECT_EQ(rebuilt.getCreditBalance(id), program.getTrialBalance().getCreditBalance(id));
+    }
+}
+
+TEST(TrialBalanceTests, testPollWhilePosting) {
+    ProgramManager program(2024);
+    AccountLibrary& accounts = program.getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 0);
+    accounts.addAccount("Sales Revenue", Revenue);
+    program.postEntry(makeEntry(accounts, Date(2024, 1, 1), 1, "Cash", "Sales Revenue"));
+
+    //Every published snapshot is taken between entries, so a poller never sees the ledger out of balance
+    bool balanced = true;
+    std::thread poller([&]() {
+        for(int i = 0; i < 20000; ++i) balanced &= program.getTrialBalance().isBalanced();
+    });
+    for(int i = 0; i < 2000; ++i) program.postEntry(makeEntry(accounts, Date(2024, 1, 2), 1, "Cash", "Sales Revenue"));
+    poller.join();
+    EXPECT_TRUE(balanced);
+    EXPECT_EQ(program.getTrialBalance().getTotals().debits, 2001);
+}
@@ -10,6 +10,8 @@ using ::testing::InSequence;
 #include "../header/Date.h"
 #include "../header/AssetAccount.h"
 
+#include <algorithm>
+
 #include <stdexcept>
 using std::invalid_argument;
 
@@ -154,44 +156,30 @@ TEST(YearRecordsTests, yearRecordsAddEntryComprehensiveTest) {
     JournalModification modification5(100, ValueType::credit, Date("12/31/2001"), "Pay $100 cash", &cash);
     fiscalYear.addEntry(&modification5);
     finalTest(fiscalYear);
+}
 
-    EXPECT_THROW({
-        JournalModification test(10, ValueType::debit, Date("01/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
-    finalTest(fiscalYear);
-    EXPECT_THROW({
-        JournalModification test(20, ValueType::debit, Date("04/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
-    finalTest(fiscalYear);
-    EXPECT_THROW({
-        JournalModification test(30, ValueType::debit, Date("06/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
-    finalTest(fiscalYear);
-    EXPECT_THROW({
-        JournalModification test(40, ValueType::debit, Date("07/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
-    finalTest(fiscalYear);
-    EXPECT_THROW({
-        JournalModification test(40, ValueType::debit, Date("07/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
-    finalTest(fiscalYear);
-    EXPECT_THROW({
-        JournalModification test(60, ValueType::debit, Date("09/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
-    finalTest(fiscalYear);
-    EXPECT_THROW({
-        JournalModification test(70, ValueType::debit, Date("10/07/2001"), "", &cash);
-        fiscalYear.addEntry(&test);
-    }, invalid_argument);
+TEST(YearRecordsTests, addEntryOutOfOrder) {
+    YearRecords fiscalYear(2001, ValueType::debit, 1000); //Start 2001 with $1000 cash
+    AssetAccount cash("Cash", 2001, 1000);
+
+    //Same postings as the comprehensive test, delivered latest first
+    JournalModification modification5(100, ValueType::credit, Date("12/31/2001"), "Pay $100 cash", &cash);
+    JournalModification modification4(500, ValueType::debit, Date("05/04/2001"), "Earn $500 cash", &cash);
+    JournalModification modification3(200, ValueType::debit, Date("02/04/2001"), "Earn $200 cash", &cash);
+    JournalModification modification2(200, ValueType::debit, Date("01/04/2001"), "Earn $200 cash", &cash);
+    JournalModification modification1(100, ValueType::debit, Date("01/03/2001"), "Earn $100 cash", &cash);
+    fiscalYear.addEntry(&modification5);
+    fiscalYear.addEntry(&modification4);
+    fiscalYear.addEntry(&modification3);
+    fiscalYear.addEntry(&modification2);
+    fiscalYear.addEntry(&modification1);
     finalTest(fiscalYear);
+
+    vector<JournalModification*> expected = {&modification1, &modification2, &modification3, &modification4, &modification5};
+    EXPECT_EQ(vector<JournalModification*>(fiscalYear.getEntries().begin(), fiscalYear.getEntries().end()), expected);
+
     EXPECT_THROW({
-        JournalModification test(80, ValueType::debit, Date("11/07/2001"), "", &cash);
+        JournalModification test(10, ValueType::debit, Date("01/07/2002"), "", &cash);
         fiscalYear.addEntry(&test);
     }, invalid_argument);
     finalTest(fiscalYear);
@@ -229,4 +217,191 @@ void finalTest(const YearRecords& fiscalYear) {
     EXPECT_EQ(fiscalYear.getQuarterRecords()[3].getMonthRecords()[2].getBeginningBalance(), 2000);
     EXPECT_EQ(fiscalYear.getQuarterRecords()[3].getMonthRecords()[2].getEndingBalance(), 1900);
     
-}
\ No newline at end of file
+}
+TEST(YearRecordsTests, periodViewsShareOneStore) {
+    YearRecords fiscalYear(2001, ValueType::debit, 1000);
+    AssetAccount cash("Cash", 2001, 1000);
+    JournalModification modification1(100, ValueType::debit, Date("08/03/2001"), "Earn $100 cash", &cash);
+    JournalModification modification2(200, ValueType::debit, Date("02/04/2001"), "Earn $200 cash", &cash);
+    JournalModification modification3(300, ValueType::credit, Date("08/01/2001"), "Pay $300 cash", &cash);
+    fiscalYear.addEntry(&modification1);
+    fiscalYear.addEntry(&modification2);
+    fiscalYear.addEntry(&modification3);
+
+    EntryView year = fiscalYear.getEntries();
+    EntryView august = fiscalYear.getMonthRecords(8).getEntries();
+    EntryView q3 = fiscalYear.getQuarterRecords()[2].getEntries();
+    ASSERT_EQ(year.size(), 3);
+    ASSERT_EQ(august.size(), 2);
+    EXPECT_EQ(august.data(), year.data() + 1);
+    EXPECT_EQ(q3.data(), august.data());
+    EXPECT_EQ(q3.size(), 2);
+    EXPECT_EQ(august[0], &modification3);
+    EXPECT_EQ(august[1], &modification1);
+    EXPECT_EQ(fiscalYear.getMonthRecords(2).getEntries()[0], &modification2);
+    EXPECT_EQ(fiscalYear.getMonthRecords(9).getEntries().size(), 0);
+}
+
+TEST(YearRecordsTests, copiesOwnTheirStore) {
+    YearRecords original(2001, ValueType::debit, 1000);
+    AssetAccount cash("Cash", 2001, 1000);
+    JournalModification modification1(100, ValueType::debit, Date("03/03/2001"), "Earn $100 cash", &cash);
+    JournalModification modification2(200, ValueType::debit, Date("01/04/2001"), "Earn $200 cash", &cash);
+    original.addEntry(&modification1);
+
+    YearRecords copy = original;
+    copy.addEntry(&modification2);
+
+    EXPECT_EQ(original.getEntries().size(), 1);
+    EXPECT_EQ(original.getMonthRecords(1).getEntries().size(), 0);
+    EXPECT_EQ(original.getEndingBalance(), 1100);
+    ASSERT_EQ(copy.getEntries().size(), 2);
+    ASSERT_EQ(copy.getMonthRecords(1).getEntries().size(), 1);
+    EXPECT_EQ(copy.getMonthRecords(1).getEntries()[0], &modification2);
+    EXPECT_EQ(copy.getMonthRecords(3).getEntries()[0], &modification1);
+    EXPECT_EQ(copy.getMonthRecords(3).getEntries().data(), copy.getEntries().data() + 1);
+    EXPECT_EQ(copy.getEndingBalance(), 1300);
+}
+
+TEST(YearRecordsTests, nestedCopiesOutliveTheirYear) {
+    AssetAccount cash("Cash", 2001, 1000);
+    JournalModification april(100, ValueType::debit, Date("04/03/2001"), "Earn $100 cash", &cash);
+    JournalModification june(50, ValueType::credit, Date("06/01/2001"), "Pay $50 cash", &cash);
+    JournalModification may(200, ValueType::debit, Date("05/04/2001"), "Earn $200 cash", &cash);
+    JournalModification january(10, ValueType::debit, Date("01/02/2001"), "Earn $10 cash", &cash);
+
+    auto copyOfSecondQuarter = [&]() {
+        YearRecords source(2001, ValueType::debit, 1000);
+        for(JournalModification* it : {&january, &june, &april}) source.addEntry(it);
+        return source.getQuarterRecords()[1];
+    };
+    QuarterRecords copy = copyOfSecondQuarter();
+    ASSERT_EQ(copy.getEntries().size(), 2);
+    EXPECT_EQ(copy.getEntries()[0], &april);
+    copy.addEntry(&may);
+    ASSERT_EQ(copy.getEntries().size(), 3);
+    EXPECT_EQ(copy.getEntries()[1], &may);
+    ASSERT_EQ(copy.getMonthRecords()[1].getEntries().size(), 1);
+    EXPECT_EQ(copy.getMonthRecords()[1].getEntries()[0], &may);
+    EXPECT_EQ(copy.getMonthRecords()[2].getEntries()[0], &june);
+    EXPECT_EQ(copy.getEndingBalance(), 1260);
+
+    YearRecords source(2001, ValueType::debit, 1000);
+    for(JournalModification* it : {&june, &april}) source.addEntry(it);
+    MonthRecords month = source.getMonthRecords(6);
+    month.addEntry(&june);
+    ASSERT_EQ(month.getEntries().size(), 2);
+    EXPECT_EQ(source.getMonthRecords(6).getEntries().size(), 1);
+}
+
+//Every period's balances and entries must agree between two records
+static void expectSameRecords(const YearRecords& expected, const YearRecords& actual) {
+    EXPECT_EQ(actual.getBeginningBalance(), expected.getBeginningBalance());
+    EXPECT_EQ(actual.getEndingBalance(), expected.getEndingBalance());
+    EXPECT_EQ(vector<JournalModification*>(actual.getEntries().begin(), actual.getEntries().end()), vector<JournalModification*>(expected.getEntries().begin(), expected.getEntries().end()));
+    for(unsigned q = 0; q < 4; ++q) {
+        const QuarterRecords& expectedQuarter = expected.getQuarterRecords()[q];
+        const QuarterRecords& actualQuarter = actual.getQuarterRecords()[q];
+        EXPECT_EQ(actualQuarter.getBeginningBalance(), expectedQuarter.getBeginningBalance()) << "quarter " << q + 1;
+        EXPECT_EQ(actualQuarter.getEndingBalance(), expectedQuarter.getEndingBalance()) << "quarter " << q + 1;
+        EXPECT_EQ(vector<JournalModification*>(actualQuarter.getEntries().begin(), actualQuarter.getEntries().end()), vector<JournalModification*>(expectedQuarter.getEntries().begin(), expectedQuarter.getEntries().end())) << "quarter " << q + 1;
+        for(unsigned m = 0; m < 3; ++m) {
+            const MonthRecords& expectedMonth = expectedQuarter.getMonthRecords()[m];
+            const MonthRecords& actualMonth = actualQuarter.getMonthRecords()[m];
+            EXPECT_EQ(actualMonth.getBeginningBalance(), expectedMonth.getBeginningBalance()) << "month " << expectedMonth.getMonth();
+            EXPECT_EQ(actualMonth.getEndingBalance(), expectedMonth.getEndingBalance()) << "month " << expectedMonth.getMonth();
+            EXPECT_EQ(vector<JournalModification*>(actualMonth.getEntries().begin(), actualMonth.getEntries().end()), vector<JournalModification*>(expectedMonth.getEntries().begin(), expectedMonth.getEntries().end())) << "month " << expectedMonth.getMonth();
+        }
+    }
+}
+
+TEST(YearRecordsTests, addEntriesMatchesAddEntry) {
+    AssetAccount cash("Cash", 2024, 1000);
+    vector<JournalModification> lines;
+    lines.reserve(64);
+    //Scattered dates with repeats, so both the in-batch sort and the merge with stored entries matter
+    const DateUnit months[] = {7, 2, 12, 2, 9, 1, 7, 5, 11, 3, 7, 2, 6, 10, 4, 8};
+    for(unsigned i = 0; i < 48; ++i) {
+        DateUnit month = months[i % 16];
+        lines.push_back(JournalModification(i + 1, i % 3 == 0 ? ValueType::credit : ValueType::debit, Date(2024, month, (i % 2) * 14 + 1), "Batch line", &cash));
+    }
+
+    YearRecords serial(2024, ValueType::debit, 1000);
+    YearRecords batched(2024, ValueType::debit, 1000);
+    vector<JournalModification*> firstBatch, secondBatch;
+    for(unsigned i = 0; i < lines.size(); ++i) {
+        serial.addEntry(&lines[i]);
+        (i < 20 ? firstBatch : secondBatch).push_back(&lines[i]);
+    }
+    batched.addEntries(firstBatch);
+    batched.addEntries(secondBatch);
+
+    expectSameRecords(serial, batched);
+}
+
+TEST(YearRecordsTests, loadEntriesMatchesAddEntry) {
+    AssetAccount cash("Cash", 2024, 1000);
+    vector<JournalModification> lines;
+    for(unsigned i = 0; i < 30; ++i) {
+        lines.push_back(JournalModification(i + 1, i % 4 == 0 ? ValueType::credit : ValueType::debit, Date(2024, i % 12 + 1, i % 3 + 1), "Loaded line", &cash));
+    }
+    YearRecords serial(2024, ValueType::debit, 1000);
+    vector<JournalModification*> sorted;
+    for(JournalModification& line : lines) {
+        serial.addEntry(&line);
+        sorted.push_back(&line);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(), [](const JournalModification* lhs, const JournalModification* rhs) { return lhs->getDate() < rhs->getDate(); });
+    YearRecords loaded(2024, ValueType::debit, 1000);
+    loaded.loadEntries(sorted);
+    expectSameRecords(serial, loaded);
+
+    //Only empty records load, and only date ordered entries
+    EXPECT_THROW(loaded.loadEntries(sorted), invalid_argument);
+    YearRecords unsorted(2024, ValueType::debit, 1000);
+    std::swap(sorted.front(), sorted.back());
+    EXPECT_THROW(unsorted.loadEntries(sorted), invalid_argument);
+    EXPECT_EQ(unsorted.getEndingBalance(), 1000);
+}
+
+TEST(YearRecordsTests, addEntriesRejectsWholeBatch) {
+    AssetAccount cash("Cash", 2024, 1000);
+    JournalModification inYear(100, ValueType::debit, Date("03/01/2024"), "Batch line", &cash);
+    JournalModification nextYear(100, ValueType::debit, Date("01/01/2025"), "Batch line", &cash);
+    YearRecords records(2024, ValueType::debit, 1000);
+
+    vector<JournalModification*> batch = {&inYear, &nextYear};
+    EXPECT_THROW({
+        records.addEntries(batch);
+    }, invalid_argument);
+    EXPECT_EQ(records.getEntries().size(), 0);
+    EXPECT_EQ(records.getEndingBalance(), 1000);
+}
+
+TEST(YearRecordsTests, dropEntriesKeepsBalances) {
+    YearRecords fiscalYear(2001, ValueType::debit, 1000);
+    AssetAccount cash("Cash", 2001, 1000);
+    JournalModification january(100, ValueType::debit, Date("01/03/2001"), "Earn $100 cash", &cash);
+    JournalModification february(200, ValueType::debit, Date("02/04/2001"), "Earn $200 cash", &cash);
+    JournalModification may(300, ValueType::credit, Date("05/01/2001"), "Pay $300 cash", &cash);
+    JournalModification june(50, ValueType::debit, Date("06/01/2001"), "Earn $50 cash", &cash);
+    for(JournalModification* it : {&may, &january, &june, &february}) fiscalYear.addEntry(it);
+
+    fiscalYear.dropEntriesThrough(4);
+    ASSERT_EQ(fiscalYear.getEntries().size(), 2);
+    EXPECT_EQ(fiscalYear.getEntries()[0], &may);
+    EXPECT_EQ(fiscalYear.getMonthRecords(1).getEntries().size(), 0);
+    EXPECT_EQ(fiscalYear.getQuarterRecords()[0].getEntries().size(), 0);
+    ASSERT_EQ(fiscalYear.getQuarterRecords()[1].getEntries().size(), 2);
+    EXPECT_EQ(fiscalYear.getMonthRecords(6).getEntries()[0], &june);
+    EXPECT_EQ(fiscalYear.getMonthRecords(2).getEndingBalance(), 1300);
+    EXPECT_EQ(fiscalYear.getQuarterRecords()[0].getEndingBalance(), 1300);
+    EXPECT_EQ(fiscalYear.getEndingBalance(), 1050);
+
+    //Later postings still land in date order after the drop
+    JournalModification lateMay(25, ValueType::debit, Date("05/20/2001"), "Earn $25 cash", &cash);
+    fiscalYear.addEntry(&lateMay);
+    EXPECT_EQ(fiscalYear.getMonthRecords(5).getEntries()[1], &lateMay);
+    EXPECT_EQ(fiscalYear.getMonthRecords(6).getBeginningBalance(), 1025);
+    EXPECT_EQ(fiscalYear.getEndingBalance(), 1075);
+}
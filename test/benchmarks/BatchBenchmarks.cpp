@@ -0,0 +1,57 @@
+#include "Benchmark.h"
+
+#include "../../header/AccountLibrary.h"
+#include "../../header/Journal.h"
+#include "../../header/JournalEntryPoster.h"
+
+#include <vector>
+using std::vector;
+
+//A nightly load: two-line entries over a modest chart, dates scattered across the year rather than in order
+static vector<JournalEntry> buildLoad(AccountLibrary& accounts, size_t entryCount, size_t accountCount) {
+    vector<JournalEntry> entries;
+    entries.reserve(entryCount);
+    for(size_t i = 0; i < entryCount; ++i) {
+        size_t scrambled = (i * 7919) % entryCount;
+        DateUnit month = scrambled % 12 + 1;
+        Date day(2024, month, scrambled / 12 % Date::daysInMonth(2024, month) + 1);
+        JournalEntry entry(day, "Nightly load");
+        entry.reserveModifications(2);
+        entry.addModification(JournalModification(7, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount(i % accountCount)));
+        entry.addModification(JournalModification(7, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount((i * 31 + 1) % accountCount)));
+        entries.push_back(std::move(entry));
+    }
+    return entries;
+}
+
+bool runBatchBenchmarks() {
+    const size_t entryCount = 200000;
+    const size_t accountCount = 20;
+    bool passed = true;
+
+    cout << "BATCH POSTING BENCHMARKS (" << entryCount << " out of order entries, " << accountCount << " accounts)" << endl;
+    Money balances[2];
+    for(int batched = 0; batched < 2; ++batched) {
+        AccountLibrary accounts(2024);
+        for(size_t i = 0; i < accountCount; ++i) accounts.addAccount("Account " + std::to_string(i), AccountType::Asset, 0);
+        Journal journal(2024);
+        JournalEntryPoster poster(&journal, &accounts);
+        vector<JournalEntry> entries = buildLoad(accounts, entryCount, accountCount);
+
+        if(batched) {
+            runBenchmark("postBatch, whole load", 1, [&](size_t) {
+                passed &= poster.postBatch(entries) == entryCount;
+            });
+        } else {
+            runBenchmark("postModification, one at a time", 1, [&](size_t) {
+                for(JournalEntry& entry : entries) passed &= poster.postModification(std::move(entry));
+            });
+        }
+        balances[batched] = accounts.getAccount("Account 3").getBalanceAsOf(Date(2024, 6, 30));
+    }
+
+    passed &= balances[0] == balances[1];
+    if(not passed) cout << "FAILED: batch posting disagreed with serial posting" << endl;
+    cout << endl;
+    return passed;
+}
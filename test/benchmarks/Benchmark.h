@@ -0,0 +1,67 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "../AllocationCounter.h"
+
+#include <chrono>
+
+#include <iomanip>
+
+#include <iostream>
+using std::cout;
+using std::endl;
+
+#include <string>
+using std::string;
+
+struct BenchmarkResult {
+    double nanosecondsPerOperation;
+    double allocationsPerOperation;
+};
+
+//Keeps the optimizer from discarding a value computed inside a benchmark loop
+template<typename T>
+inline void keepAlive(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+//Runs operation(i) for i in [0, iterations) and prints time and heap allocations per call
+template<typename Operation>
+BenchmarkResult runBenchmark(const string& name, size_t iterations, Operation operation) {
+    size_t allocationsBefore = AllocationCounter::getAllocations();
+    auto start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < iterations; ++i) {
+        operation(i);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    size_t allocations = AllocationCounter::getAllocations() - allocationsBefore;
+
+    BenchmarkResult result = {static_cast<double>(elapsed) / iterations, static_cast<double>(allocations) / iterations};
+    cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(1)
+         << std::setw(12) << result.nanosecondsPerOperation << " ns/op"
+         << std::setprecision(2) << std::setw(10) << result.allocationsPerOperation << " allocs/op" << endl;
+    return result;
+}
+
+//Each returns false when a benchmark's correctness or allocation expectation is not met
+bool runDateBenchmarks();
+bool runClosingBenchmarks();
+bool runLookupBenchmarks();
+bool runJournalBenchmarks();
+bool runBatchBenchmarks();
+bool runParallelBenchmarks();
+bool runLogBenchmarks();
+bool runSnapshotBenchmarks();
+bool runImportBenchmarks();
+bool runParserBenchmarks();
+bool runTrialBalanceBenchmarks();
+bool runStatementBenchmarks();
+bool runLedgerBenchmarks();
+bool runCompactionBenchmarks();
+
+#endif
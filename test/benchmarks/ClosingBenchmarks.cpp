@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+
+#include "../../header/ProgramManager.h"
+
+#include <memory>
+using std::unique_ptr;
+
+//Chart with accountsPerType revenue and expense accounts, each carrying entriesPerAccount postings
+static unique_ptr<ProgramManager> buildLedger(unsigned accountsPerType, unsigned entriesPerAccount) {
+    auto program = std::make_unique<ProgramManager>(2024);
+    AccountLibrary& accounts = program->getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 1000000);
+    accounts.addAccount("Retained Earnings", StockholdersEquity, 0);
+    for(unsigned i = 0; i < accountsPerType; ++i) {
+        accounts.addAccount("Revenue " + std::to_string(i), Revenue);
+        accounts.addAccount("Expense " + std::to_string(i), Expense);
+    }
+
+    for(unsigned entry = 0; entry < entriesPerAccount; ++entry) {
+        Date day(2024, entry % 12 + 1, entry % 28 + 1);
+        for(unsigned i = 0; i < accountsPerType; ++i) {
+            JournalEntry sale(day, "Sale");
+            sale.addModification(JournalModification(10, debit, day, "Sale", &accounts.getAccount("Cash")));
+            sale.addModification(JournalModification(10, credit, day, "Sale", &accounts.getAccount("Revenue " + std::to_string(i))));
+            program->postEntry(sale);
+
+            JournalEntry cost(day, "Cost");
+            cost.addModification(JournalModification(4, debit, day, "Cost", &accounts.getAccount("Expense " + std::to_string(i))));
+            cost.addModification(JournalModification(4, credit, day, "Cost", &accounts.getAccount("Cash")));
+            program->postEntry(cost);
+        }
+    }
+    return program;
+}
+
+bool runClosingBenchmarks() {
+    const unsigned accountsPerType = 200;
+    bool passed = true;
+
+    cout << "CLOSING ENTRY BENCHMARKS (" << accountsPerType << " revenue + " << accountsPerType << " expense accounts)" << endl;
+    for(unsigned entriesPerAccount : {1u, 10u, 100u}) {
+        unique_ptr<ProgramManager> program = buildLedger(accountsPerType, entriesPerAccount);
+        runBenchmark("postClosingEntry, " + std::to_string(entriesPerAccount) + " entries/account", 1, [&](size_t) {
+            program->postClosingEntry();
+        });
+        passed &= program->getAccountLibrary().getAccount("Revenue 0").getBalance() == 0;
+        passed &= program->getAccountLibrary().getAccount("Retained Earnings").getBalance() == Money(6 * accountsPerType * entriesPerAccount);
+    }
+
+    //Wide chart, net income comes from the running type totals so only the nominal accounts are walked once
+    const unsigned wideAccountsPerType = 25000;
+    unique_ptr<ProgramManager> wide = buildLedger(wideAccountsPerType, 1);
+    runBenchmark("postClosingEntry, " + std::to_string(2 * wideAccountsPerType) + " nominal accounts", 1, [&](size_t) {
+        wide->postClosingEntry();
+    });
+    passed &= wide->getAccountLibrary().getAccount("Expense 0").getBalance() == 0;
+    passed &= wide->getAccountLibrary().getAccount("Retained Earnings").getBalance() == Money(6 * wideAccountsPerType);
+
+    if(not passed) cout << "FAILED: closing entry left nominal balances open" << endl;
+    cout << endl;
+    return passed;
+}
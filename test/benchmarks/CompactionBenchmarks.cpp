@@ -0,0 +1,76 @@
+#include "Benchmark.h"
+
+#include "../../header/ProgramManager.h"
+
+#include <filesystem>
+
+#include <memory>
+using std::unique_ptr;
+
+bool runCompactionBenchmarks() {
+    const size_t entryCount = 240000;
+    const size_t accountCount = 1000;
+
+    auto program = std::make_unique<ProgramManager>(2024);
+    AccountLibrary& accounts = program->getAccountLibrary();
+    accounts.addAccount("Cash", Asset, 0);
+    for(size_t i = 0; i < accountCount; ++i) accounts.addAccount("Revenue " + std::to_string(i), Revenue);
+    //Posted in date order, as a live system would, so each month fills its own arena chunks
+    for(size_t i = 0; i < entryCount; ++i) {
+        Date day(2024, i * 12 / entryCount + 1, (i % 28) + 1);
+        JournalEntry sale(day, "Sale");
+        sale.addModification(JournalModification(1, debit, day, sale.getSharedDescription(), &accounts.getAccount(AccountId(0))));
+        sale.addModification(JournalModification(1, credit, day, sale.getSharedDescription(), &accounts.getAccount(AccountId(1 + i % accountCount))));
+        program->postEntry(std::move(sale));
+    }
+
+    string directory = (std::filesystem::temp_directory_path() / "accounting-compaction-benchmark").string();
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    ColdStore cold(&accounts, directory);
+    program->setColdStore(&cold);
+
+    cout << "COMPACTION BENCHMARKS (" << entryCount << " entries, " << accountCount + 1 << " accounts)" << endl;
+    size_t linesBefore = program->getJournal().getLines().size(), chunksBefore = program->getJournal().getLines().getChunkCount();
+    Money cashBefore = accounts.getAccount(AccountId(0)).getBalance();
+    runBenchmark("compactThrough(6), " + std::to_string(entryCount / 2) + " entries", 1, [&](size_t) {
+        program->compactThrough(6);
+    });
+    size_t chunksAfter = program->getJournal().getLines().getChunkCount();
+    cout << "arena chunks " << chunksBefore << " -> " << chunksAfter << ", lines " << linesBefore << " -> " << program->getJournal().getLines().size()
+         << ", capacity " << program->getJournal().getLines().getCapacity() << " lines" << endl;
+    runBenchmark("first detail read of a compacted month", 1, [&](size_t) {
+        keepAlive(cold.getEntries(AccountId(1), 3));
+    });
+    runBenchmark("detail read of a loaded month", 1000, [&](size_t i) {
+        keepAlive(cold.getEntries(AccountId(1 + i % accountCount), i % 6 + 1));
+    });
+
+    bool passed = chunksAfter * 3 < chunksBefore * 2 and accounts.getAccount(AccountId(0)).getBalance() == cashBefore;
+    passed &= cold.getEntries(AccountId(1), 3).size() + accounts.getAccount(AccountId(1)).getEntries().size() > 0;
+
+    //Worst case for the arena: months posted round robin, so every chunk keeps live lines of the second half
+    ProgramManager interleaved(2024);
+    interleaved.getAccountLibrary().addAccount("Cash", Asset, 0);
+    interleaved.getAccountLibrary().addAccount("Revenue", Revenue);
+    for(size_t i = 0; i < entryCount / 4; ++i) {
+        Date day(2024, i % 12 + 1, (i % 28) + 1);
+        JournalEntry sale(day, "Sale");
+        sale.addModification(JournalModification(1, debit, day, sale.getSharedDescription(), &interleaved.getAccountLibrary().getAccount(AccountId(0))));
+        sale.addModification(JournalModification(1, credit, day, sale.getSharedDescription(), &interleaved.getAccountLibrary().getAccount(AccountId(1))));
+        interleaved.postEntry(std::move(sale));
+    }
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    ColdStore interleavedCold(&interleaved.getAccountLibrary(), directory);
+    interleaved.setColdStore(&interleavedCold);
+    chunksBefore = interleaved.getJournal().getLines().getChunkCount();
+    interleaved.compactThrough(6);
+    const LineArena& pinned = interleaved.getJournal().getLines();
+    cout << "out of date order: arena chunks " << chunksBefore << " -> " << pinned.getChunkCount() << ", " << pinned.size() << " live lines in capacity for " << pinned.getCapacity() << endl;
+    passed &= pinned.getChunkCount() <= pinned.size() + 1;
+    std::filesystem::remove_all(directory);
+    if(not passed) cout << "FAILED: compaction did not free journal memory, kept chunks past its bound or changed a balance" << endl;
+    cout << endl;
+    return passed;
+}
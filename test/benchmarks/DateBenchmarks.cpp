@@ -0,0 +1,43 @@
+#include "Benchmark.h"
+
+#include "../../header/Date.h"
+
+#include <vector>
+using std::vector;
+
+bool runDateBenchmarks() {
+    const size_t iterations = 1000000;
+    vector<string> inputs;
+    for(DateUnit month = 1; month <= 12; ++month) {
+        for(DateUnit day = 1; day <= Date::daysInMonth(2024, month); ++day) {
+            inputs.push_back(Date(2024, month, day).stringForm());
+        }
+    }
+
+    cout << "DATE BENCHMARKS" << endl;
+    BenchmarkResult parse = runBenchmark("Date::tryParse(string_view)", iterations, [&](size_t i) {
+        Date parsed(2024, 1, 1);
+        Date::tryParse(inputs[i % inputs.size()], parsed);
+        keepAlive(parsed);
+    });
+    runBenchmark("Date::Date(string_view)", iterations, [&](size_t i) {
+        Date parsed(inputs[i % inputs.size()]);
+        keepAlive(parsed);
+    });
+
+    char buffer[Date::STRING_LENGTH];
+    Date toFormat(2024, 7, 4);
+    BenchmarkResult format = runBenchmark("Date::format(char*)", iterations, [&](size_t) {
+        toFormat.format(buffer);
+        keepAlive(buffer);
+    });
+    runBenchmark("Date::stringForm()", iterations, [&](size_t) {
+        string formatted = toFormat.stringForm();
+        keepAlive(formatted);
+    });
+
+    bool passed = parse.allocationsPerOperation == 0 and format.allocationsPerOperation == 0;
+    if(not passed) cout << "FAILED: Date parse/format fast path allocated" << endl;
+    cout << endl;
+    return passed;
+}
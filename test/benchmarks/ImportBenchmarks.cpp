@@ -0,0 +1,91 @@
+#include "Benchmark.h"
+
+#include "../../header/JournalEntryCreator.h"
+#include "../../header/JournalImporter.h"
+#include "../../header/JournalModificationCreator.h"
+#include "../../header/ProgramManager.h"
+
+#include <sstream>
+
+#include <vector>
+using std::vector;
+
+static void addChart(ProgramManager& program, size_t accountCount) {
+    for(size_t i = 0; i < accountCount; ++i) program.getAccountLibrary().addAccount("Operating Account " + std::to_string(i), AccountType::Asset, 0);
+}
+
+static string buildCsv(size_t entryCount, size_t accountCount) {
+    string text = "date,entry,description,side,account,amount\n";
+    for(size_t i = 0; i < entryCount; ++i) {
+        DateUnit month = i * 12 / entryCount + 1;
+        string prefix = Date(2024, month, i % Date::daysInMonth(2024, month) + 1).stringForm() + "," + std::to_string(i) + ",Invoice " + std::to_string(i % 5000) + ",";
+        string amount = std::to_string(i % 900 + 1) + "." + std::to_string(i % 90 + 10);
+        text += prefix + "dr,Operating Account " + std::to_string(i % accountCount) + "," + amount + "\n";
+        text += prefix + "cr,Operating Account " + std::to_string((i * 7 + 3) % accountCount) + "," + amount + "\n";
+    }
+    return text;
+}
+
+//What a caller has today: split each row with streams and build lines through JournalModificationCreator's text form
+static size_t importWithStreams(ProgramManager& program, const string& text) {
+    std::istringstream in(text);
+    string row, date, id, description, side, account, amount, currentId;
+    std::getline(in, row);
+    vector<JournalEntry> entries;
+    size_t posted = 0;
+    while(std::getline(in, row)) {
+        std::istringstream fields(row);
+        std::getline(fields, date, ',');
+        std::getline(fields, id, ',');
+        std::getline(fields, description, ',');
+        std::getline(fields, side, ',');
+        std::getline(fields, account, ',');
+        std::getline(fields, amount);
+        if(entries.empty() or id != currentId) {
+            if(entries.size() == 4096) {
+                posted += program.postEntries(entries);
+                entries.clear();
+            }
+            entries.emplace_back(Date(date), description);
+            currentId = id;
+        }
+        JournalModificationCreator creator(&program.getAccountLibrary(), Date(date), entries.back().getSharedDescription());
+        entries.back().addModification(creator.getJournalModification(side + " " + account + ", " + amount));
+    }
+    return posted + program.postEntries(entries);
+}
+
+bool runImportBenchmarks() {
+    const size_t entryCount = 200000;
+    const size_t accountCount = 200;
+    bool passed = true;
+
+    string text = buildCsv(entryCount, accountCount);
+    double megabytes = text.size() / 1e6;
+    cout << "CSV IMPORT BENCHMARKS (" << entryCount << " entries, " << std::setprecision(1) << megabytes << " MB, " << accountCount << " accounts)" << endl;
+
+    Money balances[2];
+    for(int streamed = 0; streamed < 2; ++streamed) {
+        ProgramManager program(2024);
+        addChart(program, accountCount);
+        BenchmarkResult result;
+        if(streamed) {
+            result = runBenchmark("istringstream rows + text creator", 1, [&](size_t) {
+                passed &= importWithStreams(program, text) == entryCount;
+            });
+        } else {
+            JournalImporter importer(&program);
+            result = runBenchmark("JournalImporter", 1, [&](size_t) {
+                importer.import(text);
+                passed &= importer.getStats().entriesPosted == entryCount;
+            });
+        }
+        cout << "    " << std::setprecision(1) << megabytes / (result.nanosecondsPerOperation / 1e9) << " MB/s" << endl;
+        balances[streamed] = program.getAccountLibrary().getAccount(AccountId(5)).getBalance();
+    }
+
+    passed &= balances[0] == balances[1];
+    if(not passed) cout << "FAILED: importers disagreed" << endl;
+    cout << endl;
+    return passed;
+}
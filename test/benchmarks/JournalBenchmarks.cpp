@@ -0,0 +1,81 @@
+#include "Benchmark.h"
+
+#include "../../header/AccountLibrary.h"
+#include "../../header/Journal.h"
+#include "../../header/JournalModificationCreator.h"
+#include "../../header/JournalEntryPoster.h"
+
+#include <utility>
+using std::pair;
+
+#include <vector>
+using std::vector;
+
+//Spreads entry i of count evenly over 2024 in date order, the way a real journal arrives
+static Date dateOfEntry(size_t i, size_t count) {
+    DateUnit dayOfYear = static_cast<DateUnit>(i * 366 / count);
+    DateUnit month = 1;
+    while(dayOfYear >= Date::daysInMonth(2024, month)) dayOfYear -= Date::daysInMonth(2024, month++);
+    return Date(2024, month, dayOfYear + 1);
+}
+
+bool runJournalBenchmarks() {
+    const size_t linesPerEntry = 20;
+    const size_t entryCount = 50000;
+
+    AccountLibrary accounts(2024);
+    vector<AccountId> ids;
+    for(size_t i = 0; i < linesPerEntry; ++i) {
+        accounts.addAccount("Account " + std::to_string(i), AccountType::Asset);
+        ids.push_back(accounts.getAccountId("Account " + std::to_string(i)));
+    }
+
+    cout << "JOURNAL BENCHMARKS (" << entryCount * linesPerEntry << " lines, " << linesPerEntry << " per entry)" << endl;
+    cout << "sizeof(JournalModification) = " << sizeof(JournalModification) << " bytes" << endl;
+
+    Journal journal(2024);
+    const string memo = "Synthetic multi-line entry with a memo longer than the small string buffer";
+    BenchmarkResult build = runBenchmark("build and journalize one entry", entryCount, [&](size_t i) {
+        Date day = dateOfEntry(i, entryCount);
+        JournalEntry entry(day, memo);
+        entry.reserveModifications(linesPerEntry);
+        JournalModificationCreator creator(&accounts, day, entry.getSharedDescription());
+        for(size_t line = 0; line < linesPerEntry; ++line) {
+            entry.addModification(creator.getJournalModification(line < linesPerEntry / 2 ? ValueType::debit : ValueType::credit, ids[line], 5));
+        }
+        journal.journalize(std::move(entry));
+    });
+    cout << std::left << std::setw(48) << "  per line" << std::right << std::setprecision(1) << std::setw(12) << build.nanosecondsPerOperation / linesPerEntry << " ns"
+         << std::setprecision(2) << std::setw(10) << build.allocationsPerOperation / linesPerEntry << " allocs" << endl;
+
+    //Every stored line should point at its entry's one copy of the memo
+    bool passed = journal.getEntries().size() == entryCount;
+    for(JournalEntry& entry : journal.getEntries()) {
+        for(const JournalModification& line : entry.getModifications()) {
+            passed &= line.getSharedDescription() == entry.getSharedDescription();
+        }
+    }
+    if(not passed) cout << "FAILED: journal lines hold their own description copies" << endl;
+
+    //Same workload through the full pipeline, with the poster's stage counters switched on
+    Journal postedJournal(2024);
+    JournalEntryPoster poster(&postedJournal, &accounts);
+    poster.setTiming(true);
+    runBenchmark("post one entry (validate, append, apply)", entryCount, [&](size_t i) {
+        Date day = dateOfEntry(i, entryCount);
+        JournalEntry entry(day, memo);
+        entry.reserveModifications(linesPerEntry);
+        JournalModificationCreator creator(&accounts, day, entry.getSharedDescription());
+        for(size_t line = 0; line < linesPerEntry; ++line) {
+            entry.addModification(creator.getJournalModification(line < linesPerEntry / 2 ? ValueType::debit : ValueType::credit, ids[line], 5));
+        }
+        poster.postModification(std::move(entry));
+    });
+    const PostingStats& stats = poster.getStats();
+    for(auto stage : {pair<const char*, std::chrono::nanoseconds>("  validate stage", stats.validateTime), pair<const char*, std::chrono::nanoseconds>("  append stage", stats.appendTime), pair<const char*, std::chrono::nanoseconds>("  apply stage", stats.applyTime)}) {
+        cout << std::left << std::setw(48) << stage.first << std::right << std::setprecision(1) << std::setw(12) << static_cast<double>(stage.second.count()) / stats.entriesPosted << " ns/entry" << endl;
+    }
+    passed &= stats.entriesPosted == entryCount and stats.linesApplied == entryCount * linesPerEntry;
+    cout << endl;
+    return passed;
+}
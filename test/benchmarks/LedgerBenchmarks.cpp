@@ -0,0 +1,39 @@
+#include "Benchmark.h"
+
+#include "../../header/Ledger.h"
+
+bool runLedgerBenchmarks() {
+    const size_t accountCount = 50000;
+    const size_t iterations = 100000;
+
+    Ledger ledger(2024);
+    AccountLibrary& accounts = ledger.getCurrentAccountLibrary();
+    accounts.addAccount("Cash", Asset, Money(accountCount));
+    accounts.addAccount("Retained Earnings", StockholdersEquity, Money(accountCount));
+    for(size_t i = 0; i < accountCount; ++i) {
+        accounts.addAccount("Revenue " + std::to_string(i), Revenue);
+        accounts.addAlias("Revenue " + std::to_string(i), "R" + std::to_string(i));
+    }
+
+    cout << "LEDGER BENCHMARKS (" << accountCount + 2 << " accounts)" << endl;
+    //Entries for a year are found by offset from the first year, so routing costs the same with several years open
+    ledger.rollover();
+    AccountLibrary& current = ledger.getCurrentAccountLibrary();
+    Date day(2025, 4, 1);
+    runBenchmark("postEntry, 2 lines, 2 open years", iterations, [&](size_t i) {
+        JournalEntry sale(day, "Sale");
+        sale.addModification(JournalModification(1, debit, day, sale.getSharedDescription(), &current.getAccount(AccountId(0))));
+        sale.addModification(JournalModification(1, credit, day, sale.getSharedDescription(), &current.getAccount(AccountId(2 + i % accountCount))));
+        ledger.postEntry(sale);
+    });
+    runBenchmark("rollover, closing every revenue account", 1, [&](size_t) {
+        ledger.rollover();
+    });
+
+    bool passed = ledger.getAccountLibrary(2026).getAccount("Cash").getBeginningBalance() == Money(accountCount + iterations);
+    passed &= ledger.getAccountLibrary(2026).getAccount("Retained Earnings").getBeginningBalance() == Money(accountCount + iterations);
+    passed &= ledger.getAccountLibrary(2026).getAccountId("R7") == AccountId(9);
+    if(not passed) cout << "FAILED: rollover did not carry balances or aliases forward" << endl;
+    cout << endl;
+    return passed;
+}
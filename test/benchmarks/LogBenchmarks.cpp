@@ -0,0 +1,64 @@
+#include "Benchmark.h"
+
+#include "../../header/JournalLog.h"
+#include "../../header/ProgramManager.h"
+
+#include <cstdio>
+
+#include <filesystem>
+
+#include <vector>
+using std::vector;
+
+static void addChart(ProgramManager& program) {
+    program.getAccountLibrary().addAccount("Cash", AccountType::Asset, 0);
+    program.getAccountLibrary().addAccount("Sales", AccountType::Revenue, 0);
+}
+
+static JournalEntry buildSale(AccountLibrary& accounts, size_t i) {
+    Date day(2024, i % 12 + 1, i % 28 + 1);
+    JournalEntry entry(day, "Logged sale");
+    entry.reserveModifications(2);
+    entry.addModification(JournalModification(9, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount(AccountId(0))));
+    entry.addModification(JournalModification(9, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount(AccountId(1))));
+    return entry;
+}
+
+bool runLogBenchmarks() {
+    const size_t entryCount = 2000;
+    const string path = (std::filesystem::temp_directory_path() / "AccountingBenchmarks.wal").string();
+    bool passed = true;
+
+    cout << "WRITE-AHEAD LOG BENCHMARKS (" << entryCount << " two line entries, time per entry)" << endl;
+    for(size_t groupSize : {size_t(1), size_t(16), size_t(256)}) {
+        std::remove(path.c_str());
+        ProgramManager program(2024);
+        addChart(program);
+        vector<JournalEntry> entries;
+        for(size_t i = 0; i < entryCount; ++i) entries.push_back(buildSale(program.getAccountLibrary(), i));
+        {
+            JournalLog log(path, 2024, groupSize);
+            program.setJournalLog(&log);
+            string name = groupSize == 1 ? string("post + fsync every entry") : "post + group commit of " + std::to_string(groupSize);
+            runBenchmark(name, entryCount, [&](size_t i) {
+                passed &= program.postEntry(std::move(entries[i]));
+            });
+            log.flush();
+            program.setJournalLog(nullptr);
+        }
+
+        if(groupSize == 1) {
+            ProgramManager recovered(2024);
+            addChart(recovered);
+            runBenchmark("recover, per entry", entryCount, [&](size_t i) {
+                if(i == 0) passed &= JournalLog::recover(path, recovered) == entryCount;
+            });
+            passed &= recovered.getAccountLibrary().getAccount("Cash").getBalance() == program.getAccountLibrary().getAccount("Cash").getBalance();
+        }
+    }
+    std::remove(path.c_str());
+
+    if(not passed) cout << "FAILED: logged postings did not recover to the same ledger" << endl;
+    cout << endl;
+    return passed;
+}
@@ -0,0 +1,44 @@
+#include "Benchmark.h"
+
+#include "../../header/AccountLibrary.h"
+
+#include <vector>
+using std::vector;
+
+bool runLookupBenchmarks() {
+    const size_t accountCount = 100000;
+    const size_t iterations = 1000000;
+
+    //Every account gets its name plus two aliases, so the table holds 300k names
+    AccountLibrary accounts(2024);
+    vector<string> probes;
+    for(size_t i = 0; i < accountCount; ++i) {
+        string name = "Operating Account " + std::to_string(i);
+        accounts.addAccount(name, AccountType::Expense);
+        accounts.addAlias(name, "OA-" + std::to_string(i));
+        accounts.addAlias(name, "Alias For Account Number " + std::to_string(i));
+        probes.push_back(i % 2 == 0 ? "operating account " + std::to_string(i) : "ALIAS FOR ACCOUNT NUMBER " + std::to_string(i));
+    }
+
+    cout << "NAME LOOKUP BENCHMARKS (" << accountCount * 3 << " names)" << endl;
+    BenchmarkResult byString = runBenchmark("getAccount(const string&), mixed case", iterations, [&](size_t i) {
+        const Account& account = accounts.getAccount(probes[(i * 7919) % probes.size()]);
+        keepAlive(account);
+    });
+    BenchmarkResult byView = runBenchmark("getAccountId(string_view), mixed case", iterations, [&](size_t i) {
+        AccountId id = accounts.getAccountId(string_view(probes[(i * 7919) % probes.size()]));
+        keepAlive(id);
+    });
+    //Steady state after resolving names to symbols up front, as importers do
+    vector<SymbolId> symbols;
+    for(const string& probe : probes) symbols.push_back(accounts.findSymbol(probe));
+    BenchmarkResult bySymbol = runBenchmark("resolve(SymbolId)", iterations, [&](size_t i) {
+        AccountId id = accounts.resolve(symbols[(i * 7919) % symbols.size()]);
+        keepAlive(id);
+    });
+
+    bool passed = bySymbol.allocationsPerOperation == 0 and byString.allocationsPerOperation == 0 and byView.allocationsPerOperation == 0;
+    if(not passed) cout << "FAILED: account name lookup allocated" << endl;
+    cout << endl;
+    return passed;
+}
@@ -0,0 +1,79 @@
+#include "Benchmark.h"
+
+#include "../../header/AccountLibrary.h"
+#include "../../header/Journal.h"
+#include "../../header/JournalEntryPoster.h"
+#include "../../header/ThreadPool.h"
+
+#include <algorithm>
+
+#include <thread>
+
+#include <vector>
+using std::vector;
+
+//Skewed load: account k is hit roughly in proportion to 1 / (k + 1), so a few accounts carry most lines
+static vector<JournalEntry> buildSkewedLoad(AccountLibrary& accounts, size_t entryCount, size_t accountCount) {
+    vector<size_t> weights;
+    for(size_t k = 0; k < accountCount; ++k) {
+        size_t weight = accountCount / (k + 1);
+        weights.insert(weights.end(), std::max<size_t>(weight, 1), k);
+    }
+
+    vector<JournalEntry> entries;
+    entries.reserve(entryCount);
+    for(size_t i = 0; i < entryCount; ++i) {
+        size_t scrambled = (i * 7919) % entryCount;
+        DateUnit month = scrambled % 12 + 1;
+        Date day(2024, month, scrambled / 12 % Date::daysInMonth(2024, month) + 1);
+        AccountId debit = weights[(i * 2654435761u) % weights.size()];
+        AccountId credit = weights[(i * 40503u + 17) % weights.size()];
+        JournalEntry entry(day, "Skewed load");
+        entry.reserveModifications(2);
+        entry.addModification(JournalModification(3, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount(debit)));
+        entry.addModification(JournalModification(3, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount(credit)));
+        entries.push_back(std::move(entry));
+    }
+    return entries;
+}
+
+bool runParallelBenchmarks() {
+    const size_t entryCount = 200000;
+    const size_t accountCount = 64;
+    const unsigned maxThreads = std::max(std::thread::hardware_concurrency(), 4u);
+    bool passed = true;
+
+    cout << "PARALLEL POSTING BENCHMARKS (" << entryCount << " entries, " << accountCount << " skewed accounts, "
+         << std::thread::hardware_concurrency() << " hardware threads)" << endl;
+    vector<Money> serialBalances;
+    vector<size_t> serialCounts;
+    for(unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        AccountLibrary accounts(2024);
+        for(size_t i = 0; i < accountCount; ++i) accounts.addAccount("Account " + std::to_string(i), AccountType::Asset, 0);
+        Journal journal(2024);
+        JournalEntryPoster poster(&journal, &accounts);
+        ThreadPool pool(threads);
+        poster.setThreadPool(&pool);
+        vector<JournalEntry> entries = buildSkewedLoad(accounts, entryCount, accountCount);
+
+        runBenchmark("postBatch, " + std::to_string(threads) + " threads", 1, [&](size_t) {
+            passed &= poster.postBatch(entries) == entryCount;
+        });
+
+        //Every thread count must leave each account exactly as the single threaded run did
+        for(AccountId id = 0; id < accountCount; ++id) {
+            const Account& account = accounts.getAccount(id);
+            if(threads == 1) {
+                serialBalances.push_back(account.getBalanceAsOf(Date(2024, 6, 30)));
+                serialCounts.push_back(account.getEntries().size());
+            } else {
+                passed &= account.getBalanceAsOf(Date(2024, 6, 30)) == serialBalances[id];
+                passed &= account.getEntries().size() == serialCounts[id];
+            }
+        }
+    }
+
+    if(not passed) cout << "FAILED: parallel posting disagreed with serial posting" << endl;
+    cout << endl;
+    return passed;
+}
@@ -0,0 +1,56 @@
+#include "Benchmark.h"
+
+#include "../../header/JournalModificationCreator.h"
+#include "../../header/ModificationParser.h"
+
+#include <sstream>
+
+#include <vector>
+using std::vector;
+
+//The previous text path: a stream, a token buffer and an account string per line, amount read with getline
+static JournalModification parseWithStream(AccountLibrary* accounts, const Date& day, const shared_ptr<const string>& description, const string& modification) {
+    ValueType valueType = ValueType::debit;
+    string accountIdentifier = "";
+    std::basic_istringstream modificationParser(modification);
+    string buffer = "";
+    modificationParser >> buffer;
+    valueType = toupper(buffer[0]) == 'C' ? ValueType::credit : ValueType::debit;
+    getline(modificationParser >> std::ws, accountIdentifier, ',');
+    string amountText = "";
+    getline(modificationParser, amountText);
+    return JournalModification(Money::parse(amountText), valueType, day, description, &accounts->getAccount(accountIdentifier));
+}
+
+bool runParserBenchmarks() {
+    const size_t iterations = 500000;
+    AccountLibrary accounts(2024);
+    vector<string> lines;
+    for(size_t i = 0; i < 64; ++i) {
+        accounts.addAccount("Operating Account " + std::to_string(i), AccountType::Asset);
+        lines.push_back(string(i % 2 ? "Cr. " : "Dr. ") + "operating account " + std::to_string(i) + ", " + std::to_string(i * 131 % 9000) + "." + std::to_string(i % 90 + 10));
+    }
+    Date day(2024, 6, 1);
+    JournalModificationCreator creator(&accounts, day, "Parsed line");
+    shared_ptr<const string> description = std::make_shared<const string>("Parsed line");
+
+    cout << "MODIFICATION LINE PARSING BENCHMARKS" << endl;
+    Money streamTotal, viewTotal;
+    runBenchmark("istringstream + getline + Money::parse", iterations, [&](size_t i) {
+        JournalModification line = parseWithStream(&accounts, day, description, lines[i % lines.size()]);
+        streamTotal += line.get().first;
+    });
+    BenchmarkResult parseOnly = runBenchmark("parseModification (no account lookup)", iterations, [&](size_t i) {
+        ModificationParse parse = parseModification(lines[i % lines.size()]);
+        keepAlive(parse);
+    });
+    BenchmarkResult created = runBenchmark("JournalModificationCreator, string_view", iterations, [&](size_t i) {
+        JournalModification line = creator.getJournalModification(string_view(lines[i % lines.size()]));
+        viewTotal += line.get().first;
+    });
+
+    bool passed = streamTotal == viewTotal and parseOnly.allocationsPerOperation == 0 and created.allocationsPerOperation == 0;
+    if(not passed) cout << "FAILED: parsers disagreed or the string_view path allocated" << endl;
+    cout << endl;
+    return passed;
+}
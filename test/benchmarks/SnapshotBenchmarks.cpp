@@ -0,0 +1,88 @@
+#include "Benchmark.h"
+
+#include "../../header/ProgramManager.h"
+#include "../../header/Snapshot.h"
+
+#include <cstdio>
+
+#include <filesystem>
+
+#include <vector>
+using std::vector;
+
+static void addChart(ProgramManager& program, size_t accountCount) {
+    for(size_t i = 0; i < accountCount; ++i) program.getAccountLibrary().addAccount("Account " + std::to_string(i), AccountType::Asset, 0);
+}
+
+static vector<JournalEntry> buildYear(AccountLibrary& accounts, size_t entryCount, size_t accountCount) {
+    vector<JournalEntry> entries;
+    entries.reserve(entryCount);
+    for(size_t i = 0; i < entryCount; ++i) {
+        DateUnit month = i * 12 / entryCount + 1;
+        Date day(2024, month, i % Date::daysInMonth(2024, month) + 1);
+        JournalEntry entry(day, "Entry " + std::to_string(i % 1000));
+        entry.reserveModifications(2);
+        entry.addModification(JournalModification(5, ValueType::debit, day, entry.getSharedDescription(), &accounts.getAccount(AccountId(i % accountCount))));
+        entry.addModification(JournalModification(5, ValueType::credit, day, entry.getSharedDescription(), &accounts.getAccount(AccountId((i * 7 + 3) % accountCount))));
+        entries.push_back(std::move(entry));
+    }
+    return entries;
+}
+
+bool runSnapshotBenchmarks() {
+    const size_t entryCount = 200000;
+    const size_t accountCount = 50;
+    const string path = (std::filesystem::temp_directory_path() / "AccountingBenchmarks.snap").string();
+    bool passed = true;
+
+    cout << "SNAPSHOT BENCHMARKS (" << entryCount << " entries, " << accountCount << " accounts, one startup per op)" << endl;
+    ProgramManager original(2024);
+    addChart(original, accountCount);
+    vector<JournalEntry> entries = buildYear(original.getAccountLibrary(), entryCount, accountCount);
+    vector<JournalEntry> replay = entries;
+    original.postEntries(entries);
+
+    runBenchmark("startup by reposting every entry", 1, [&](size_t) {
+        ProgramManager restarted(2024);
+        addChart(restarted, accountCount);
+        //Entries hold the original chart's accounts, so a restart resolves them again as a text import would
+        for(const JournalEntry& entry : replay) {
+            JournalEntry reposted(entry.getDate(), entry.getSharedDescription());
+            for(const JournalModification& line : entry.getModifications()) {
+                reposted.addModification(JournalModification(line.get().first, line.get().second, line.getDate(), reposted.getSharedDescription(), &restarted.getAccountLibrary().getAccount(line.getAffectedAccount()->getName())));
+            }
+            passed &= restarted.postEntry(std::move(reposted));
+        }
+        keepAlive(restarted.getAccountLibrary().getAccount(AccountId(0)).getBalance());
+    });
+    runBenchmark("Snapshot::write", 1, [&](size_t) {
+        Snapshot::write(path, original);
+    });
+    runBenchmark("Snapshot open (map and header)", 1, [&](size_t) {
+        Snapshot snapshot(path);
+        passed &= snapshot.getEntryCount() == entryCount;
+    });
+    Snapshot snapshot(path);
+    runBenchmark("Snapshot::verify (checksum)", 1, [&](size_t) {
+        snapshot.verify();
+    });
+    runBenchmark("sum one account from the columns", 1, [&](size_t) {
+        Money total;
+        for(size_t line = 0; line < snapshot.getLineCount(); ++line) {
+            if(snapshot.getLineAccounts()[line] == 0) total += Money::fromMinorUnits(snapshot.getLineAmounts()[line]);
+        }
+        keepAlive(total);
+    });
+    runBenchmark("startup by restoring the snapshot", 1, [&](size_t) {
+        ProgramManager restored(2024);
+        passed &= snapshot.restore(restored) == entryCount;
+        for(AccountId id = 0; id < accountCount; ++id) {
+            passed &= restored.getAccountLibrary().getAccount(id).getBalance() == original.getAccountLibrary().getAccount(id).getBalance();
+        }
+    });
+    std::remove(path.c_str());
+
+    if(not passed) cout << "FAILED: restored snapshot disagreed with the original" << endl;
+    cout << endl;
+    return passed;
+}
@@ -0,0 +1,50 @@
+#include "Benchmark.h"
+
+#include "../../header/FinancialStatements.h"
+
+#include <sstream>
+
+bool runStatementBenchmarks() {
+    const size_t accountsPerType = 10000;
+    const size_t iterations = 1000000;
+
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", Asset, 0);
+    for(size_t i = 0; i < accountsPerType; ++i) {
+        accounts.addAccount("Revenue " + std::to_string(i), Revenue);
+        accounts.addAccount("Expense " + std::to_string(i), Expense);
+    }
+    ClosingEngine closing(&accounts);
+    FinancialStatements statements(&accounts, &closing);
+
+    Account& cash = accounts.getAccount(AccountId(0));
+    Date day(2024, 5, 1);
+    JournalEntry sale(day, "Sale");
+    sale.addModification(JournalModification(10, debit, day, sale.getSharedDescription(), &cash));
+    sale.addModification(JournalModification(10, credit, day, sale.getSharedDescription(), &accounts.getAccount(AccountId(1))));
+
+    cout << "STATEMENT BENCHMARKS (" << 2 * accountsPerType << " nominal accounts)" << endl;
+    BenchmarkResult update = runBenchmark("entryPosted, 2 lines", iterations, [&](size_t) {
+        closing.entryPosted(sale);
+    });
+    BenchmarkResult total = runBenchmark("getNetIncome()", iterations, [&](size_t) {
+        Money netIncome = statements.getNetIncome();
+        keepAlive(netIncome);
+    });
+    //Period statements read one balance per account from its period records, never its entries
+    BenchmarkResult quarter = runBenchmark("getPeriodChange(Revenues, Quarter)", 100, [&](size_t i) {
+        Money change = statements.getPeriodChange(StatementCategory::Revenues, PeriodLength::Quarter, i % 4 + 1);
+        keepAlive(change);
+    });
+    runBenchmark("renderIncomeStatement(Year)", 10, [&](size_t) {
+        std::ostringstream output;
+        statements.renderIncomeStatement(output, PeriodLength::Year);
+        keepAlive(output);
+    });
+
+    bool passed = update.allocationsPerOperation == 0 and total.allocationsPerOperation == 0 and quarter.allocationsPerOperation == 0;
+    passed &= statements.getNetIncome() == Money(10 * iterations);
+    if(not passed) cout << "FAILED: statement totals allocated or disagreed with postings" << endl;
+    cout << endl;
+    return passed;
+}
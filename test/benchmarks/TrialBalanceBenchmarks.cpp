@@ -0,0 +1,47 @@
+#include "Benchmark.h"
+
+#include "../../header/TrialBalance.h"
+
+#include <algorithm>
+
+bool runTrialBalanceBenchmarks() {
+    const size_t accountCount = 100000;
+    const size_t iterations = 1000000;
+
+    AccountLibrary accounts(2024);
+    accounts.addAccount("Cash", Asset, Money(accountCount));
+    for(size_t i = 0; i < accountCount; ++i) accounts.addAccount("Revenue " + std::to_string(i), Revenue, 1);
+    TrialBalance trialBalance(&accounts);
+
+    Account& cash = accounts.getAccount(AccountId(0));
+    Date day(2024, 6, 1);
+    JournalEntry sale(day, "Sale");
+    sale.addModification(JournalModification(10, debit, day, sale.getSharedDescription(), &cash));
+    sale.addModification(JournalModification(10, credit, day, sale.getSharedDescription(), &accounts.getAccount(AccountId(1))));
+
+    cout << "TRIAL BALANCE BENCHMARKS (" << accountCount + 1 << " accounts)" << endl;
+    //Baseline, what a poller had to do before: sum every account into its column
+    BenchmarkResult scan = runBenchmark("scan every account", 10, [&](size_t) {
+        TrialBalanceTotals totals;
+        accounts.forEachAccount([&](const Account& account) {
+            Money balance = account.getBalanceType() == debit ? account.getBalance() : -account.getBalance();
+            totals.debits += std::max(balance, Money(0));
+            totals.credits += std::max(-balance, Money(0));
+        });
+        keepAlive(totals);
+    });
+    BenchmarkResult poll = runBenchmark("getTotals()", iterations, [&](size_t) {
+        TrialBalanceTotals totals = trialBalance.getTotals();
+        keepAlive(totals);
+    });
+    BenchmarkResult update = runBenchmark("entryPosted, 2 lines", iterations, [&](size_t) {
+        trialBalance.entryPosted(sale);
+    });
+
+    bool passed = poll.allocationsPerOperation == 0 and update.allocationsPerOperation == 0;
+    passed &= trialBalance.isBalanced();
+    passed &= poll.nanosecondsPerOperation < scan.nanosecondsPerOperation;
+    if(not passed) cout << "FAILED: trial balance polling was not constant time or did not balance" << endl;
+    cout << endl;
+    return passed;
+}
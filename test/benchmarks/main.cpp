@@ -0,0 +1,22 @@
+#include "Benchmark.h"
+
+int main() {
+    bool passed = true;
+
+    passed &= runDateBenchmarks();
+    passed &= runClosingBenchmarks();
+    passed &= runLookupBenchmarks();
+    passed &= runJournalBenchmarks();
+    passed &= runBatchBenchmarks();
+    passed &= runParallelBenchmarks();
+    passed &= runLogBenchmarks();
+    passed &= runSnapshotBenchmarks();
+    passed &= runImportBenchmarks();
+    passed &= runParserBenchmarks();
+    passed &= runTrialBalanceBenchmarks();
+    passed &= runStatementBenchmarks();
+    passed &= runLedgerBenchmarks();
+    passed &= runCompactionBenchmarks();
+
+    return passed ? 0 : 1;
+}
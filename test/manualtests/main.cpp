@@ -94,7 +94,7 @@ int main() {
 
     cout << "RUNNING ACCOUNT DISPLAY TESTS" << endl;
 
-    AccountDisplayer displayCash1(&accounts.getAccount("Cash"), Period(Date("01/01/2024"), Date("02/31/2024")));
+    AccountDisplayer displayCash1(&accounts.getAccount("Cash"), Period(Date("01/01/2024"), Date("02/29/2024")));
     displayCash1.display(cout);
    
     AccountDisplayer displayCash2(&accounts.getAccount("Cash"), Period(Date("03/01/2024"), Date("05/31/2024")));